@@ -0,0 +1,84 @@
+#!/bin/bash
+
+# Host-side throughput benchmark for the simulators.
+#
+#   bench.sh proj1    run from proj1/, reports MIPS of the interpreter
+#   bench.sh proj2    run from proj2/, reports cache accesses/second for
+#                     each cache geometry
+#
+# Environment:
+#   REPS        repetitions per measurement (default 5)
+#   SCALE       workload scale passed to gen.sh (default 10 for proj1,
+#               1 for proj2)
+#   GEOMETRIES  proj2 geometries, "blockSize.numberOfSets.blocksPerSet ..."
+
+mode=${1:?usage: bench.sh proj1|proj2}
+reps=${REPS:-5}
+if [ $mode = proj1 ]; then scale=${SCALE:-10}; else scale=${SCALE:-1}; fi
+geometries=${GEOMETRIES:-"1.256.1 4.64.1 4.16.4 16.16.2 16.1.16"}
+dir=bench_out
+workloads="loop stream store chase"
+
+# the workloads use proj1's syntax, whose labels can be longer than
+# proj2's assembler takes, so both modes assemble with proj1's
+assembler=$(dirname $0)/../proj1/assembler
+[ -x $assembler ] || { echo "bench.sh: build $assembler first"; exit 1; }
+
+$(dirname $0)/gen.sh $dir $scale || exit 1
+for w in $workloads; do
+    $assembler $dir/$w.as $dir/$w.mc || exit 1
+done
+
+# run <stats file> <command...>; prints the wall time in microseconds
+run() {
+    stats=$1; shift
+    start=$(date +%s%N)
+    "$@" -q -s $stats > /dev/null || exit 1
+    end=$(date +%s%N)
+    echo $(( (end - start) / 1000 ))
+}
+
+# counter <stats file>; prints instructions or cache accesses from "final"
+counter() {
+    sed -n '/"final"/,$p' $1 | awk -v mode=$mode '
+        /"instructions"/ { gsub(/[^0-9]/, ""); instrs = $0 }
+        /"cache"/ { n = split($0, f, /[^0-9]+/); for (i = 1; i <= n; i++) acc += f[i] }
+        END { print (mode == "proj1") ? instrs : acc }'
+}
+
+# summarize <count> <times...>; median and variance of the rate in M/s
+summarize() {
+    count=$1; shift
+    printf "%s\n" "$@" | sort -n | awk -v count=$count '
+        { rate[NR] = count / $1 }
+        END {
+            n = NR;
+            med = (n % 2) ? rate[(n + 1) / 2] : (rate[n / 2] + rate[n / 2 + 1]) / 2;
+            for (i = 1; i <= n; i++) mean += rate[i] / n;
+            for (i = 1; i <= n; i++) var += (rate[i] - mean) ^ 2;
+            var = (n > 1) ? var / (n - 1) : 0;
+            printf("%10.2f %12.4f %12d\n", med, var, count);
+        }'
+}
+
+if [ $mode = proj1 ]; then
+    printf "%-8s %10s %12s %12s\n" workload "MIPS(med)" variance instrs
+    for w in $workloads; do
+        times=""
+        for r in $(seq $reps); do
+            times="$times $(run $dir/$w.json ./simulator $dir/$w.mc)"
+        done
+        printf "%-8s %s\n" $w "$(summarize $(counter $dir/$w.json) $times)"
+    done
+else
+    printf "%-8s %-10s %10s %12s %12s\n" workload geometry "Macc/s(med)" variance accesses
+    for w in $workloads; do
+        for g in $geometries; do
+            times=""
+            for r in $(seq $reps); do
+                times="$times $(run $dir/$w.json ./simulator $dir/$w.mc ${g//./ })"
+            done
+            printf "%-8s %-10s %s\n" $w $g "$(summarize $(counter $dir/$w.json) $times)"
+        done
+    done
+fi
@@ -0,0 +1,102 @@
+#!/bin/bash
+
+# Generate the long-running LC3101 benchmark workloads.
+#
+#   gen.sh <output dir> [scale]
+#
+# scale multiplies the iteration counts (default 1). At scale 1 each
+# workload executes a few million instructions.
+
+out=${1:?usage: gen.sh <output dir> [scale]}
+scale=${2:-1}
+mkdir -p $out
+
+# loop: register-only countdown loop with an add/nand body
+cat > $out/loop.as <<END
+        lw      0 1 count
+        lw      0 2 neg1
+        lw      0 3 one
+loop    beq     0 1 done
+        add     3 3 4
+        nand    4 3 5
+        nand    5 5 5
+        add     4 5 6
+        add     1 2 1
+        beq     0 0 loop
+done    halt
+count   .fill   $((500000 * scale))
+neg1    .fill   -1
+one     .fill   1
+END
+
+# stream: sum a 16384-word array, reps times
+cat > $out/stream.as <<END
+        lw      0 6 neg1
+        lw      0 7 one
+        lw      0 5 reps
+outer   beq     0 5 done
+        lw      0 1 size
+        lw      0 2 base
+inner   beq     0 1 next
+        lw      2 3 0
+        add     4 3 4
+        add     2 7 2
+        add     1 6 1
+        beq     0 0 inner
+next    add     5 6 5
+        beq     0 0 outer
+done    halt
+neg1    .fill   -1
+one     .fill   1
+reps    .fill   $((20 * scale))
+size    .fill   16384
+base    .fill   32768
+END
+
+# store: fill a 16384-word array with a counter, reps times
+cat > $out/store.as <<END
+        lw      0 6 neg1
+        lw      0 7 one
+        lw      0 5 reps
+outer   beq     0 5 done
+        lw      0 1 size
+        lw      0 2 base
+inner   beq     0 1 next
+        sw      2 1 0
+        add     2 7 2
+        add     1 6 1
+        beq     0 0 inner
+next    add     5 6 5
+        beq     0 0 outer
+done    halt
+neg1    .fill   -1
+one     .fill   1
+reps    .fill   $((25 * scale))
+size    .fill   16384
+base    .fill   32768
+END
+
+# chase: follow a 4096-node linked list laid out in a shuffled order
+cat > $out/chase.as <<END
+        lw      0 1 steps
+        lw      0 6 neg1
+        lw      0 2 head
+loop    beq     0 1 done
+        lw      2 2 0
+        add     1 6 1
+        beq     0 0 loop
+done    halt
+steps   .fill   $((1000000 * scale))
+neg1    .fill   -1
+head    .fill   n0
+END
+awk 'BEGIN {
+    n = 4096; srand(3101);
+    for (i = 0; i < n; i++) order[i] = i;
+    for (i = n - 1; i > 0; i--) {
+        j = int(rand() * (i + 1)); t = order[i]; order[i] = order[j]; order[j] = t;
+    }
+    # order[] is the list, node order[k] points at order[k+1]
+    for (k = 0; k < n; k++) succ[order[k]] = order[(k + 1) % n];
+    for (i = 0; i < n; i++) printf("n%d\t.fill\tn%d\n", i, succ[i]);
+}' >> $out/chase.as
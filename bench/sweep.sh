@@ -0,0 +1,35 @@
+#!/bin/bash
+
+# Cache design sweep for performance per watt, run from proj2/.
+#
+#   sweep.sh <machine-code file> [simulator options]
+#
+# Runs the program once per cache geometry with the energy model on and
+# prints, for each, the misses, cycles, energy, energy-delay product, area
+# and MIPS per watt. Extra options (-p, -d, -et ...) are passed to every
+# run.
+#
+# Environment:
+#   GEOMETRIES  "blockSize.numberOfSets.blocksPerSet ..."
+
+prog=${1:?usage: sweep.sh <machine-code file> [simulator options]}
+shift
+geometries=${GEOMETRIES:-"1.256.1 4.64.1 4.16.4 16.16.2 16.1.16"}
+stats=$(mktemp)
+trap "rm -f $stats" EXIT
+
+printf "%-10s %10s %12s %12s %12s %10s %10s\n" \
+    geometry misses cycles "energy(nJ)" "EDP(J*s)" "area(mm2)" "MIPS/W"
+for g in $geometries; do
+    ./simulator $prog ${g//./ } -q -e -s $stats "$@" > /dev/null || exit 1
+    sed -n '/"final"/,$p' $stats | awk -v g=$g '
+        /"cache"/ && !misses { n = split($0, f, /"misses": /);
+                               for (i = 2; i <= n; i++) misses += f[i] + 0 }
+        /"energy"/ { energy = 1 }
+        energy && /: / { v = $0; sub(/.*: /, "", v); sub(/,$/, "", v);
+                         k = $1; gsub(/[":]/, "", k); e[k] = v }
+        energy && /}/ { energy = 0 }
+        END { printf("%-10s %10d %12d %12.1f %12.3e %10.4f %10.1f\n", g,
+                     misses, e["cycles"], e["total_pj"] / 1000, e["edp_js"],
+                     e["area_mm2"], e["mips_per_watt"]) }'
+done
@@ -3,12 +3,24 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/time.h>
 
 #define MAXLINELENGTH 1000
-#define MAXINSTR 1000
+#define MAXINSTR 65536 /* one label slot per word of memory */
+#define CACHEVERSION 1 /* bump when the output for a given input changes */
+#define CACHEKBYTES 16384 /* default size bound of the object cache */
 
 int readAndParse(FILE *, char *, char *, char *, char *, char *);
 int isNumber(char *);
+void peephole(FILE *, FILE *, FILE *);
+void cacheKey(char *, int, int, char *);
+int cacheFetch(char *, char *, char *, char *);
+void cacheStore(char *, char *, FILE *, char *, FILE *, char *, long);
 
 struct instr {
     int addr;
@@ -21,8 +33,11 @@ enum { false, true };
 int
 main(int argc, char *argv[])
 {
-    char *inFileString, *outFileString;
-    FILE *inFilePtr, *outFilePtr;
+    char *inFileString, *outFileString, *symFileString = NULL;
+    FILE *inFilePtr, *outFilePtr, *symFilePtr = NULL;
+    char *cacheDir = NULL;
+    long cacheKBytes = CACHEKBYTES;
+    char key[33];
     char label  [MAXLINELENGTH],
          opcode [MAXLINELENGTH], 
          arg0   [MAXLINELENGTH],
@@ -36,16 +51,38 @@ main(int argc, char *argv[])
     int mc = 0;
     int count = 0;
     int label_found = false;
+    int optimize = false;
+    int i;
+    int j;
 
-    if (argc != 3) {
-        printf("error: usage: %s <assembly-code-file> <machine-code-file>\n",
-            argv[0]);
+    for (i = 3; i < argc; ++i) {
+        if (!strcmp(argv[i], "-O"))
+            optimize = true;
+        else if (!strcmp(argv[i], "-g") && i + 1 < argc)
+            symFileString = argv[++i];
+        else if (!strcmp(argv[i], "-C") && i + 1 < argc)
+            cacheDir = argv[++i];
+        else if (!strcmp(argv[i], "-Cs") && i + 1 < argc)
+            cacheKBytes = atol(argv[++i]);
+        else
+            argc = 0;
+    }
+    if (argc < 3 || cacheKBytes <= 0) {
+        printf("error: usage: %s <assembly-code-file> <machine-code-file> [-O] [-g symbol-file]\n"
+            "\t[-C cache-dir [-Cs kbytes]]\n", argv[0]);
         exit(1);
     }
 
     inFileString = argv[1];
     outFileString = argv[2];
 
+    /* same source and options as an earlier run, copy its output */
+    if (cacheDir != NULL) {
+        cacheKey(inFileString, optimize, symFileString != NULL, key);
+        if (cacheFetch(cacheDir, key, outFileString, symFileString))
+            return(0);
+    }
+
     inFilePtr = fopen(inFileString, "r");
     if (inFilePtr == NULL) {
         printf("error in opening %s\n", inFileString);
@@ -57,6 +94,15 @@ main(int argc, char *argv[])
         exit(1);
     }
 
+    /* the symbol table has an "address line [label]" line for every word */
+    if (symFileString != NULL) {
+        symFilePtr = fopen(symFileString, "w");
+        if (symFilePtr == NULL) {
+            printf("error in opening %s\n", symFileString);
+            exit(1);
+        }
+    }
+
     /*
      * Make the first pass through to grab the labels and store the
      * addresses.
@@ -77,8 +123,6 @@ main(int argc, char *argv[])
     /*
      * ERROR CHECK: make sure there are no duplicate labels
      */
-    int i;
-    int j;
     for ( i = 0; i < line_number; ++i ) {
         if ( strcmp(labels[i].lbl, "") ) {
             for ( j = 0; j < line_number; ++j) {
@@ -91,6 +135,14 @@ main(int argc, char *argv[])
 
     rewind(inFilePtr);
 
+    if (optimize) {
+        peephole(inFilePtr, outFilePtr, symFilePtr);
+        if (cacheDir != NULL)
+            cacheStore(cacheDir, key, outFilePtr, outFileString, symFilePtr,
+                symFileString, cacheKBytes * 1024);
+        return(0);
+    }
+
     /*
      * Make the second pass, this time 
      */
@@ -267,9 +319,17 @@ main(int argc, char *argv[])
         else
             exit(1);
 
+        if (symFilePtr != NULL)
+            fprintf(symFilePtr, "%d %d%s%s\n", count, count + 1,
+                label[0] ? " " : "", label);
+
         count++;
     }
 
+    if (cacheDir != NULL)
+        cacheStore(cacheDir, key, outFilePtr, outFileString, symFilePtr,
+            symFileString, cacheKBytes * 1024);
+
     return(0);
 }
 
@@ -330,4 +390,532 @@ isNumber(char *string)
     /* return 1 if string is a number */
     int i;
     return( (sscanf(string, "%d", &i)) == 1);
-}
\ No newline at end of file
+}
+
+/*
+ * Peephole optimizer, used with -O. The whole program is parsed into a
+ * list of lines with every symbolic field and beq offset resolved to the
+ * line it refers to, rewritten, and then encoded with addresses worked
+ * out from the lines that are left.
+ *
+ * Passes:
+ *   - beq chains are threaded through noops and unconditional beqs
+ *   - duplicate constant .fills are merged
+ *   - in straight-line code, a lw of a constant a register already holds
+ *     is dropped, one another register holds becomes an add, and loads of
+ *     0 and -1 become add/nand of register 0
+ *   - noops that nothing branches to or refers to are dropped
+ *
+ * A .fill is constant if it is labeled, only read by lw with regA 0,
+ * never has its address taken and every sw in the program stores to a
+ * label with regA 0. Deleting a line moves everything after it, so lines
+ * are only deleted if no beq offset or lw/sw address is a number that
+ * could point into the program.
+ */
+#define OPFILL 8
+#define MAXLINES MAXINSTR
+
+static const char *opNames[] =
+    { "add", "nand", "lw", "sw", "beq", "cmov", "halt", "noop", ".fill" };
+
+struct asmLine {
+    char *label;
+    int op;
+    int regA;
+    int regB;
+    int destR;
+    int ref; /* line a symbolic field or beq refers to, -1 if numeric */
+    int num; /* numeric field: offset, address or .fill value */
+    int deleted;
+};
+
+int
+findLine(struct asmLine *lines, int n, char *label)
+{
+    int i;
+
+    for (i = 0; i < n; ++i)
+        if (lines[i].label != NULL && !strcmp(lines[i].label, label))
+            return i;
+
+    printf("error: missing label %s\n", label);
+    exit(1);
+}
+
+/* unconditional beq, or a noop, that control passes straight through */
+int
+passThrough(struct asmLine *l)
+{
+    return l->op == noop || (l->op == beq && l->regA == l->regB && l->ref >= 0);
+}
+
+void
+peephole(FILE *inFilePtr, FILE *outFilePtr, FILE *symFilePtr)
+{
+    char label[MAXLINELENGTH], opcode[MAXLINELENGTH], arg0[MAXLINELENGTH],
+         arg1[MAXLINELENGTH], arg2[MAXLINELENGTH];
+    struct asmLine *lines;
+    struct asmLine *l;
+    int *target;
+    int *constant;
+    int *addr;
+    int held[8]; /* held[r] is the value register r holds, if known[r] */
+    int known[8];
+    int relocatable = true;
+    int unknownStores = false;
+    int indexed; /* first line an indexed lw/sw could reach */
+    char *field;
+    int n = 0;
+    int i;
+    int j;
+    int r;
+    int hops;
+    int mc;
+
+    lines = malloc(sizeof(struct asmLine) * MAXLINES);
+
+    while (readAndParse(inFilePtr, label, opcode, arg0, arg1, arg2)) {
+        if (n >= MAXLINES) {
+            printf("error: too many lines\n");
+            exit(1);
+        }
+        l = &lines[n];
+        memset(l, 0, sizeof(struct asmLine));
+        l->label = label[0] ? strdup(label) : NULL;
+        for (l->op = 0; l->op <= OPFILL && strcmp(opcode, opNames[l->op]); ++l->op)
+            ;
+        if (l->op > OPFILL) {
+            printf("error: unrecognized opcode %s at address %d\n", opcode, n);
+            exit(1);
+        }
+        l->regA = atoi(arg0);
+        l->regB = atoi(arg1);
+        l->destR = atoi(arg2);
+        l->ref = -1;
+        n++;
+    }
+
+    /*
+     * resolve fields. A lw/sw with regA != 0 can reach any line from its
+     * label on, so nothing there may be merged, deleted or moved.
+     */
+    indexed = n;
+    rewind(inFilePtr);
+    for (i = 0; readAndParse(inFilePtr, label, opcode, arg0, arg1, arg2); ++i) {
+        l = &lines[i];
+        field = (l->op == OPFILL) ? arg0 : arg2;
+        if (l->op != lw && l->op != sw && l->op != beq && l->op != OPFILL)
+            continue;
+
+        if (!isNumber(field))
+            l->ref = findLine(lines, n, field);
+        else if (l->op == beq) {
+            l->num = atoi(field);
+            if (i + 1 + l->num >= 0 && i + 1 + l->num < n)
+                l->ref = i + 1 + l->num;
+            else
+                relocatable = false;
+        }
+        else {
+            l->num = atoi(field);
+            if (l->op != OPFILL && (l->regA != 0 || (l->num >= 0 && l->num < n)))
+                relocatable = false;
+        }
+
+        if ((l->op == lw || l->op == sw) && l->regA != 0 && l->ref >= 0 &&
+            l->ref < indexed)
+            indexed = l->ref;
+        if (l->op == sw && (l->regA != 0 || l->ref < 0))
+            unknownStores = true;
+    }
+
+    /* thread beq chains */
+    for (i = 0; i < n; ++i) {
+        l = &lines[i];
+        if (l->op != beq || l->ref < 0)
+            continue;
+        for (hops = 0; hops < n && passThrough(&lines[l->ref]); ++hops) {
+            if (lines[l->ref].op == noop) {
+                if (l->ref + 1 >= n)
+                    break;
+                l->ref++;
+            }
+            else
+                l->ref = lines[l->ref].ref;
+        }
+    }
+
+    /* find branch targets and constant .fills */
+    target = calloc(n, sizeof(int));
+    constant = calloc(n, sizeof(int));
+    for (i = 0; i < n; ++i)
+        constant[i] = lines[i].op == OPFILL && lines[i].label != NULL &&
+                      i < indexed &&
+                      lines[i].ref < 0 && !unknownStores &&
+                      (i + 1 >= n || lines[i + 1].op != OPFILL ||
+                       lines[i + 1].label != NULL);
+    for (i = 0; i < n; ++i) {
+        l = &lines[i];
+        if (l->ref < 0)
+            continue;
+        if (l->op == beq)
+            target[l->ref] = true;
+        else if (l->op != lw || l->regA != 0)
+            constant[l->ref] = false;
+    }
+
+    /* merge duplicate constants */
+    for (i = 0; relocatable && i < n; ++i) {
+        if (!constant[i] || lines[i].deleted)
+            continue;
+        for (j = i + 1; j < n; ++j) {
+            if (constant[j] && !lines[j].deleted && lines[j].num == lines[i].num) {
+                lines[j].deleted = true;
+                for (r = 0; r < n; ++r)
+                    if (lines[r].ref == j)
+                        lines[r].ref = i;
+            }
+        }
+    }
+
+    /* constant loads in straight-line code */
+    for (r = 0; r < 8; ++r)
+        known[r] = false;
+    for (i = 0; i < n; ++i) {
+        l = &lines[i];
+        if (target[i])
+            for (r = 0; r < 8; ++r)
+                known[r] = false;
+        known[0] = true;
+        held[0] = 0;
+
+        if (l->op == lw && l->regA == 0 && l->regB != 0 && l->ref >= 0 &&
+            constant[l->ref]) {
+            int val = lines[l->ref].num;
+
+            if (known[l->regB] && held[l->regB] == val && relocatable &&
+                i < indexed) {
+                l->deleted = true;
+                continue;
+            }
+            for (r = 0; r < 8 && !(known[r] && held[r] == val); ++r)
+                ;
+            if (r < 8) {
+                l->op = add;
+                l->regA = r;
+                l->destR = l->regB;
+                l->regB = 0;
+            }
+            else if (val == -1) {
+                l->op = nand;
+                l->regA = 0;
+                l->destR = l->regB;
+                l->regB = 0;
+            }
+            else {
+                known[l->regB] = true;
+                held[l->regB] = val;
+                continue;
+            }
+            l->ref = -1;
+            known[l->destR] = true;
+            held[l->destR] = val;
+        }
+        else if (l->op == add || l->op == nand || l->op == cmov) {
+            if (l->op == add && known[l->regA] && known[l->regB]) {
+                held[l->destR] = held[l->regA] + held[l->regB];
+                known[l->destR] = true;
+            }
+            else if (l->op == nand && known[l->regA] && known[l->regB]) {
+                held[l->destR] = ~(held[l->regA] & held[l->regB]);
+                known[l->destR] = true;
+            }
+            else
+                known[l->destR] = false;
+        }
+        else if (l->op == lw)
+            known[l->regB] = false;
+    }
+
+    /* drop noops nothing refers to */
+    for (i = 0; relocatable && i < n; ++i)
+        if (lines[i].op == noop && !target[i] && i < indexed)
+            lines[i].deleted = true;
+    for (i = 0; i < n; ++i)
+        if (lines[i].ref >= 0 && lines[lines[i].ref].deleted &&
+            lines[lines[i].ref].op == noop)
+            lines[lines[i].ref].deleted = false;
+
+    /* new addresses; a deleted line takes the address of the next one */
+    addr = malloc(sizeof(int) * (n + 1));
+    for (i = 0, j = 0; i < n; ++i) {
+        addr[i] = j;
+        if (!lines[i].deleted)
+            j++;
+    }
+    addr[n] = j;
+
+    for (i = 0; i < n; ++i) {
+        l = &lines[i];
+        if (l->deleted)
+            continue;
+
+        if (l->op == add || l->op == nand || l->op == cmov)
+            mc = (l->op << 22) | (l->regA << 19) | (l->regB << 16) | l->destR;
+        else if (l->op == halt || l->op == noop)
+            mc = (l->op << 22);
+        else if (l->op == OPFILL)
+            mc = (l->ref >= 0) ? addr[l->ref] : l->num;
+        else {
+            if (l->op == beq)
+                mc = (l->ref >= 0) ? addr[l->ref] - addr[i] - 1 : l->num;
+            else
+                mc = (l->ref >= 0) ? addr[l->ref] : l->num;
+            mc = (l->op << 22) | (l->regA << 19) | (l->regB << 16) | (mc & 0xFFFF);
+        }
+        fprintf(outFilePtr, "%d\n", mc);
+        if (symFilePtr != NULL)
+            fprintf(symFilePtr, "%d %d%s%s\n", addr[i], i + 1,
+                l->label ? " " : "", l->label ? l->label : "");
+    }
+}
+
+/*
+ * Object cache, with -C dir. An entry is named by a 128 bit hash of
+ * CACHEVERSION, the options that change the output and the source, and
+ * holds the machine code, and the symbol table if -g was given, that the
+ * source assembled to. A hit copies them out without parsing anything.
+ * Entries are written under a temporary name and renamed into place, so
+ * parallel runs only ever see whole entries. A hit touches its entry, and
+ * once the directory grows past its size bound the least recently used
+ * entries are removed. Runs that fail exit before anything is stored, and
+ * a directory that can't be written to just isn't used.
+ */
+#define CACHEMAGIC "lc3101-asm"
+#define CACHESTALE 3600 /* seconds before a temporary file is abandoned */
+
+struct cacheEntry {
+    char name[40];
+    long size;
+    time_t used;
+};
+
+void
+cacheMix(unsigned long long *h, int c)
+{
+    h[0] = (h[0] ^ c) * 1099511628211ULL;
+    h[1] = (h[1] + c + 1) * 0xff51afd7ed558ccdULL;
+    h[1] ^= h[1] >> 29;
+}
+
+void
+cacheKey(char *inFileString, int optimize, int sym, char *key)
+{
+    unsigned long long h[2] = { 14695981039346656037ULL, 0x9E3779B97F4A7C15ULL };
+    char head[64];
+    FILE *inFilePtr;
+    char *p;
+    int c;
+
+    inFilePtr = fopen(inFileString, "r");
+    if (inFilePtr == NULL) {
+        printf("error in opening %s\n", inFileString);
+        exit(1);
+    }
+
+    sprintf(head, "%d %d %d\n", CACHEVERSION, optimize, sym);
+    for (p = head; *p; ++p)
+        cacheMix(h, (unsigned char)*p);
+    while ((c = getc(inFilePtr)) != EOF)
+        cacheMix(h, c);
+    fclose(inFilePtr);
+
+    sprintf(key, "%016llx%016llx", h[0], h[1]);
+}
+
+/*
+ * The whole of a file, or NULL if it can't be read.
+ */
+char *
+cacheRead(char *name, long *len)
+{
+    FILE *f;
+    char *buf;
+
+    f = fopen(name, "r");
+    if (f == NULL)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    *len = ftell(f);
+    rewind(f);
+    buf = malloc(*len + 1);
+    if (fread(buf, 1, *len, f) != *len) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    return buf;
+}
+
+void
+cacheWrite(char *name, char *buf, long len)
+{
+    FILE *f;
+
+    f = fopen(name, "w");
+    if (f == NULL || fwrite(buf, 1, len, f) != len || fclose(f) != 0) {
+        printf("error in opening %s\n", name);
+        exit(1);
+    }
+}
+
+/*
+ * Copy out the entry for key, returning false if there isn't a whole one.
+ */
+int
+cacheFetch(char *dir, char *key, char *outFileString, char *symFileString)
+{
+    char path[MAXLINELENGTH];
+    char magic[32];
+    long mcLen;
+    long symLen;
+    int version;
+    char *buf;
+    FILE *f;
+
+    snprintf(path, sizeof(path), "%s/%s", dir, key);
+    f = fopen(path, "r");
+    if (f == NULL)
+        return false;
+
+    if (fscanf(f, "%31s %d %ld %ld", magic, &version, &mcLen, &symLen) != 4 ||
+        strcmp(magic, CACHEMAGIC) || version != CACHEVERSION ||
+        mcLen < 0 || symLen < 0 || getc(f) != '\n') {
+        fclose(f);
+        return false;
+    }
+    buf = malloc(mcLen + symLen + 1);
+    if (fread(buf, 1, mcLen + symLen, f) != mcLen + symLen) {
+        free(buf);
+        fclose(f);
+        return false;
+    }
+    fclose(f);
+
+    cacheWrite(outFileString, buf, mcLen);
+    if (symFileString != NULL)
+        cacheWrite(symFileString, buf + mcLen, symLen);
+    free(buf);
+
+    utimes(path, NULL);
+    return true;
+}
+
+int
+byUse(const void *a, const void *b)
+{
+    const struct cacheEntry *x = a;
+    const struct cacheEntry *y = b;
+
+    return (x->used > y->used) - (x->used < y->used);
+}
+
+/*
+ * Remove least recently used entries until dir holds at most limit bytes,
+ * and temporary files left by runs that died.
+ */
+void
+cacheTrim(char *dir, long limit)
+{
+    char path[MAXLINELENGTH];
+    struct cacheEntry *entries = NULL;
+    struct dirent *e;
+    struct stat st;
+    time_t now = time(NULL);
+    long total = 0;
+    int size = 0;
+    int n = 0;
+    int i;
+    DIR *d;
+
+    d = opendir(dir);
+    if (d == NULL)
+        return;
+    while ((e = readdir(d)) != NULL) {
+        snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+        if (!strncmp(e->d_name, ".tmp.", 5)) {
+            if (stat(path, &st) == 0 && now - st.st_mtime > CACHESTALE)
+                unlink(path);
+            continue;
+        }
+        if (strlen(e->d_name) != 32 || stat(path, &st) < 0 ||
+            !S_ISREG(st.st_mode))
+            continue;
+
+        if (n == size) {
+            size = size ? 2 * size : 64;
+            entries = realloc(entries, size * sizeof(struct cacheEntry));
+        }
+        strcpy(entries[n].name, e->d_name);
+        entries[n].size = st.st_size;
+        entries[n].used = st.st_mtime;
+        total += st.st_size;
+        n++;
+    }
+    closedir(d);
+
+    if (total > limit) {
+        qsort(entries, n, sizeof(struct cacheEntry), byUse);
+        for (i = 0; i < n && total > limit; ++i) {
+            snprintf(path, sizeof(path), "%s/%s", dir, entries[i].name);
+            if (unlink(path) == 0 || errno == ENOENT)
+                total -= entries[i].size;
+        }
+    }
+    free(entries);
+}
+
+/*
+ * Close the finished output files and store them as the entry for key.
+ */
+void
+cacheStore(char *dir, char *key, FILE *outFilePtr, char *outFileString,
+    FILE *symFilePtr, char *symFileString, long limit)
+{
+    char path[MAXLINELENGTH];
+    char tmp[MAXLINELENGTH];
+    char *mc;
+    char *sym = NULL;
+    long mcLen;
+    long symLen = 0;
+    FILE *f;
+    int ok;
+
+    fclose(outFilePtr);
+    if (symFilePtr != NULL)
+        fclose(symFilePtr);
+
+    mc = cacheRead(outFileString, &mcLen);
+    if (symFileString != NULL)
+        sym = cacheRead(symFileString, &symLen);
+    if (mc == NULL || (symFileString != NULL && sym == NULL))
+        return;
+
+    if (mkdir(dir, 0777) < 0 && errno != EEXIST)
+        return;
+    snprintf(tmp, sizeof(tmp), "%s/.tmp.%d", dir, (int)getpid());
+    snprintf(path, sizeof(path), "%s/%s", dir, key);
+    f = fopen(tmp, "w");
+    if (f == NULL)
+        return;
+    fprintf(f, "%s %d %ld %ld\n", CACHEMAGIC, CACHEVERSION, mcLen, symLen);
+    fwrite(mc, 1, mcLen, f);
+    fwrite(sym, 1, symLen, f);
+    ok = !ferror(f);
+    if (fclose(f) != 0 || !ok || rename(tmp, path) < 0)
+        unlink(tmp);
+    free(mc);
+    free(sym);
+
+    cacheTrim(dir, limit);
+}
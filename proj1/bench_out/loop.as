@@ -0,0 +1,14 @@
+        lw      0 1 count
+        lw      0 2 neg1
+        lw      0 3 one
+loop    beq     0 1 done
+        add     3 3 4
+        nand    4 3 5
+        nand    5 5 5
+        add     4 5 6
+        add     1 2 1
+        beq     0 0 loop
+done    halt
+count   .fill   5000000
+neg1    .fill   -1
+one     .fill   1
@@ -1,6 +1,8 @@
 #!/bin/bash
 
 # Simple script to test program
-./assembler $1.as $1.mc;
+# Assembled output is reused from $ASMCACHE (default .asmcache) when the
+# source hasn't changed.
+./assembler $1.as $1.mc -C ${ASMCACHE:-.asmcache};
 ./simulator $1.mc > output;
 less output;
@@ -3,22 +3,245 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/mman.h>
 
-#define NUMMEMORY 65536 /* maximum number of words in memory */
+#define NUMMEMORY 65536 /* default number of words in memory */
 #define NUMREGS 8 /* number of machine registers */
 #define MAXLINELENGTH 1000
+#define PAGESHIFT 12 /* memory is allocated in pages of 4096 words */
+#define PAGESIZE (1 << PAGESHIFT)
 
 enum { add, nand, lw, sw, beq, cmov, halt, noop };
 enum { false, true };
 
 typedef struct stateStruct {
   int pc;
-  int mem[NUMMEMORY];
+  int **pages; /* sparse memory, a page is allocated on first write */
+  int numPages;
+  int memSize;
   int reg[NUMREGS];
   int numMemory;
 } stateType;
 
+/*
+ * Performance counters, written out as JSON when the simulator exits.
+ */
+typedef struct statsStruct {
+  long long instrs;
+  long long opcodes[8];
+  long long beq_taken;
+  long long beq_not_taken;
+  long long loads;
+  long long stores;
+} statsType;
+
+statsType STATS;
+
+FILE *STATS_OUT; /* stats file until "final" is written, for statsAbort */
+
+int QUIET; /* don't print the state before every instruction */
+
+/*
+ * Live counters for proj2's simtop, with -live file. The file is mapped
+ * shared and rewritten every LIVEINTERVAL instructions under a sequence
+ * lock: seq is odd while an update is being written, and a reader retries
+ * if it saw it odd or saw it change. The layout is proj2's, there is just
+ * no cache to count.
+ */
+#define LIVEMAGIC 0x4c495645
+#define LIVEINTERVAL 1048576
+
+typedef struct liveSharedStruct {
+  unsigned magic;
+  unsigned seq;
+  int pid;
+  int done; /* the simulator finished */
+  int pc;
+  int cache; /* the counters below mean something */
+  long long instrs;
+  long long accesses;
+  long long hits;
+  long long misses;
+  long long start_ns;
+  long long now_ns;
+  char sim[16];
+  char name[64];
+} liveShared;
+
+typedef struct liveStruct {
+  liveShared *shm; /* NULL if off */
+  long long next; /* instruction count of the next update, LLONG_MAX if off */
+} liveType;
+
+liveType LIVE;
+
+/*
+ * Branch prediction for beq. Every beq is run past the selected predictor
+ * and a BTB, a predicted taken beq only redirects fetch if the BTB holds
+ * its target.
+ */
+enum { bp_nt, bp_btfn, bp_bimodal, bp_gshare, bp_tournament, bp_tage,
+       NUMPREDICTORS };
+
+#define BPTABLEBITS 12 /* 4096 entry counter tables */
+#define BTBENTRIES 512
+#define TAGETABLES 4
+#define TAGEBITS 10 /* entries per tagged TAGE table */
+
+typedef struct tageEntryStruct {
+  unsigned short tag;
+  signed char ctr; /* taken if >= 0 */
+  unsigned char useful;
+} tageEntry;
+
+typedef struct predictorStruct {
+  int kind;
+  int penalty; /* cycles lost per mispredict when not pipelined */
+  unsigned int history; /* global history, newest outcome in bit 0 */
+  unsigned char *bimodal; /* 2-bit counters, taken if >= 2 */
+  unsigned char *gshare;
+  unsigned char *chooser; /* tournament, >= 2 picks gshare */
+  tageEntry *tage[TAGETABLES];
+  int btb_pc[BTBENTRIES];
+  int btb_target[BTBENTRIES];
+
+  long long branches;
+  long long mispredicts;
+  long long btb_misses;
+} predictorType;
+
+predictorType BP;
+
+static const char *bp_names[NUMPREDICTORS] =
+    { "nt", "btfn", "bimodal", "gshare", "tournament", "tage" };
+static const int tage_history[TAGETABLES] = { 4, 8, 16, 32 };
+
+/*
+ * Per-pc profile, kept with -prof or -fold. Addresses are mapped back to
+ * the source with the symbol table the assembler writes with -g, one
+ * "address line [label]" line per word.
+ */
+enum { fold_instrs, fold_misses, fold_stalls };
+
+typedef struct profEntryStruct {
+  long long execs;
+  long long imisses;
+  long long dmisses;
+  long long mispredicts;
+  long long stalls;
+} profEntry;
+
+typedef struct profileStruct {
+  int size; /* words profiled, from address 0 */
+  profEntry *pc; /* NULL if not profiling */
+  int *line; /* source line of each word, 0 if unknown */
+  char **label;
+  int *leader; /* word starts a basic block */
+  char *name; /* program, the root frame of folded stacks */
+} profileType;
+
+profileType PROF;
+
+/*
+ * Pre-decoded program. When the state isn't printed every step the
+ * program words are decoded once, and common LC3101 idioms starting at a
+ * word are fused into a single superinstruction. The word after a fused
+ * pair keeps its own decoding, so a beq into the middle of a pair just
+ * runs the second instruction on its own.
+ */
+enum { f_and = 8, /* nand d = a, b ; nand d d d */
+       f_add_add, /* two adds */
+       f_add_jump, /* add, then beq 0 0 */
+       f_nand_jump, /* nand, then beq 0 0 */
+       f_jump, /* beq 0 0 on its own */
+       f_none /* plain instruction, or not decodable up front */
+};
+
+typedef struct decodedStruct {
+  int op; /* opcode, or fused op */
+  int regA;
+  int regB;
+  int destR;
+  int offset;
+  int op2; /* second instruction of a fused pair */
+  int regA2;
+  int regB2;
+  int destR2;
+  int offset2;
+} decodedType;
+
+/*
+ * Lockstep mode, with -k. The program and every machine-code file named in
+ * the list file, normally the same program assembled with different .fill
+ * data, are run as instances LANES at a time. A warp of LANES instances
+ * keeps each register as one vector, and each step runs the instruction at
+ * the lowest pc of the lanes still running, masked to just the lanes at
+ * that pc. Lanes that part on a beq run separately until their pcs meet
+ * again, and lanes aren't regrouped across warps, so a warp takes as long
+ * as its slowest lane. Lane memories are interleaved word by word. A lane
+ * that does something the interpreter would exit on is stopped there and
+ * reported, and the rest of the warp carries on.
+ *
+ * The lane operations use GCC vector extensions. lockWarp is built twice,
+ * for AVX-512, where a register is one vector, and for the baseline, where
+ * it's four SSE2 vectors, and the host's best is picked at startup. GCC's
+ * AVX2 code for 16-int vectors was slower than the SSE2 code, so there is
+ * no AVX2 build.
+ */
+#define LANES 16
+#define NOPC (INT_MAX / 2) /* above any pc, a halted lane's for lanesMin */
+
+typedef int lanes __attribute__ ((vector_size (LANES * sizeof(int))));
+
+typedef struct instanceStruct {
+  char *name;
+  int *image; /* the machine-code file */
+  int size;
+  long long instrs;
+  int reg[NUMREGS];
+  int pc;
+  char *error; /* why the instance was stopped, NULL if it halted */
+} instanceType;
+
+typedef struct lockstepStruct {
+  int count; /* instances, 0 if not in lockstep mode */
+  instanceType *inst;
+  int mem_size;
+  int *mem; /* lane l of word a is at a * LANES + l */
+  long long steps;
+  long long warps;
+} lockstepType;
+
+lockstepType LOCK;
+
 void printState(stateType *);
+void usage(char *);
+void printStatsSample(FILE *, int);
+void printStatsFinal(FILE *);
+void statsAbort(void);
+int convertNum(int);
+void initMemory(stateType *, int);
+int memRead(stateType *, int);
+void memWrite(stateType *, int, int);
+void copyState(stateType *, stateType *);
+void freeState(stateType *);
+int bpKind(char *);
+void bpInit(predictorType *);
+void bpFree(predictorType *);
+int bpBranch(predictorType *, int, int, int);
+int runDecoded(stateType *, FILE *, int);
+void profInit(profileType *, int, char *);
+void profSymbols(profileType *, char *);
+void writeProfile(profileType *, stateType *, char *, char *, int);
+void lockLoad(lockstepType *, char *);
+void lockList(lockstepType *, char *);
+int runLockstep(lockstepType *);
+void liveOpen(liveType *, char *, char *);
+void livePublish(liveType *, int, int);
 
 int
 main(int argc, char *argv[])
@@ -34,11 +257,120 @@ main(int argc, char *argv[])
   int offset;
   int num_instr;
   int is_halt;
+  int instr;
+  int word;
+  int i;
+
+  int mem_size;
+  char *stats_name;
+  FILE *stats_file;
+  int sample_interval;
+  int fuse;
+  char *sym_name;
+  char *prof_name;
+  char *fold_name;
+  int fold_metric;
+  int mispredict;
+  int prof_pc;
+  char *list_name;
+  char *live_name;
+
+  if (argc < 2)
+    usage(argv[0]);
+
+  mem_size = NUMMEMORY;
+  stats_name = NULL;
+  stats_file = NULL;
+  sample_interval = 0;
+  BP.penalty = 2;
+  fuse = true;
+  sym_name = NULL;
+  prof_name = NULL;
+  fold_name = NULL;
+  fold_metric = fold_instrs;
+  list_name = NULL;
+  live_name = NULL;
+  LIVE.next = LLONG_MAX;
+
+  for (i = 2; i < argc; ++i) {
+    if (!strcmp(argv[i], "-m") && i + 1 < argc)
+      mem_size = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+      stats_name = argv[++i];
+    else if (!strcmp(argv[i], "-i") && i + 1 < argc)
+      sample_interval = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-q"))
+      QUIET = true;
+    else if (!strcmp(argv[i], "-bp") && i + 1 < argc) {
+      if ( (BP.kind = bpKind(argv[++i])) < 0 )
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-bk") && i + 1 < argc)
+      BP.penalty = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-F"))
+      fuse = false;
+    else if (!strcmp(argv[i], "-k") && i + 1 < argc)
+      list_name = argv[++i];
+    else if (!strcmp(argv[i], "-live") && i + 1 < argc)
+      live_name = argv[++i];
+    else if (!strcmp(argv[i], "-sym") && i + 1 < argc)
+      sym_name = argv[++i];
+    else if (!strcmp(argv[i], "-prof") && i + 1 < argc)
+      prof_name = argv[++i];
+    else if (!strcmp(argv[i], "-fold") && i + 1 < argc)
+      fold_name = argv[++i];
+    else if (!strcmp(argv[i], "-foldm") && i + 1 < argc) {
+      ++i;
+      if (!strcmp(argv[i], "instrs"))
+        fold_metric = fold_instrs;
+      else if (!strcmp(argv[i], "misses"))
+        fold_metric = fold_misses;
+      else if (!strcmp(argv[i], "stalls"))
+        fold_metric = fold_stalls;
+      else
+        usage(argv[0]);
+    }
+    else
+      usage(argv[0]);
+  }
 
-  if (argc != 2) {
-    printf("error: usage: %s <machine-code file>\n", argv[0]);
+  if (mem_size <= 0 || sample_interval < 0 || BP.penalty < 0)
+    usage(argv[0]);
+  if (list_name != NULL && (prof_name != NULL || fold_name != NULL ||
+                            sample_interval || BP.kind != bp_nt ||
+                            live_name != NULL)) {
+    printf("error: -k can't be combined with -prof, -fold, -i, -bp or -live\n");
     exit(1);
   }
+  bpInit(&BP);
+
+  if (stats_name != NULL) {
+    stats_file = fopen(stats_name, "w");
+    if (stats_file == NULL) {
+      printf("error: can't open stats file %s", stats_name);
+      perror("fopen");
+      exit(1);
+    }
+    fprintf(stats_file, "{\n  \"samples\": [\n");
+    STATS_OUT = stats_file;
+    atexit(statsAbort);
+  }
+
+  if (list_name != NULL) {
+    LOCK.mem_size = mem_size;
+    lockLoad(&LOCK, argv[1]);
+    lockList(&LOCK, list_name);
+    i = runLockstep(&LOCK);
+    if (stats_file != NULL) {
+      STATS_OUT = NULL;
+      printStatsFinal(stats_file);
+      fclose(stats_file);
+    }
+    bpFree(&BP);
+    return(i ? 1 : 0);
+  }
+
+  initMemory(&state, mem_size);
 
   filePtr = fopen(argv[1], "r");
     if (filePtr == NULL) {
@@ -50,18 +382,28 @@ main(int argc, char *argv[])
   /* read in the entire machine-code file into memory */
   for (state.numMemory = 0; fgets(line, MAXLINELENGTH, filePtr) != NULL;
     state.numMemory++) {
-    if (sscanf(line, "%d", state.mem+state.numMemory) != 1) {
+    if (sscanf(line, "%d", &word) != 1) {
         printf("error in reading address %d\n", state.numMemory);
         exit(1);
     }
-    printf("memory[%d]=%d\n", state.numMemory, state.mem[state.numMemory]);
+    memWrite(&state, state.numMemory, word);
+    if (!QUIET)
+      printf("memory[%d]=%d\n", state.numMemory, word);
+  }
+
+  if (live_name != NULL)
+    liveOpen(&LIVE, live_name, argv[1]);
+
+  if (prof_name != NULL || fold_name != NULL) {
+    profInit(&PROF, state.numMemory, argv[1]);
+    if (sym_name != NULL)
+      profSymbols(&PROF, sym_name);
   }
 
   /*
    * Initialise the state of the machine. Initialise all of
    * the registers to 0;
    */
-  int i;
   for (i = 0; i < NUMREGS; ++i) {
     state.reg[i] = 0;
   }
@@ -70,17 +412,33 @@ main(int argc, char *argv[])
   state.pc = 0;
   is_halt = false;
 
+  /*
+   * nothing is printed until the end, so the fast loop can be used, unless
+   * every pc has to be counted
+   */
+  if (QUIET && fuse && PROF.pc == NULL) {
+    num_instr = runDecoded(&state, stats_file, sample_interval);
+    is_halt = true;
+  }
+
   while ( !is_halt ) {
-    printState(&state);
+    if (!QUIET)
+      printState(&state);
+
+    instr = memRead(&state, state.pc);
+    prof_pc = state.pc;
+    mispredict = false;
+
+    opcode = ( (instr >> 22) & 7 );
 
-    opcode = ( (state.mem[state.pc] >> 22) & 7 );
+    regA = ( (instr >> 19) & 7 );
+    regB = ( (instr >> 16) & 7 );
 
-    regA = ( (state.mem[state.pc] >> 19) & 7 );
-    regB = ( (state.mem[state.pc] >> 16) & 7 );
+    destR = ( (instr >> 0) & 7 );
 
-    destR = ( (state.mem[state.pc] >> 0) & 7 );
+    offset = convertNum( (instr >> 0) & 65535 );
 
-    offset = convertNum( (state.mem[state.pc] >> 0) & 65535 );
+    STATS.opcodes[opcode]++;
 
     switch (opcode) {
       case add:
@@ -102,8 +460,10 @@ main(int argc, char *argv[])
         break;
 
       case lw:
-        if ( destR != 0)
-          state.reg[regB] = ( state.mem[ (state.reg[regA] + offset) ] );
+        if ( regB != 0) {
+          state.reg[regB] = memRead(&state, state.reg[regA] + offset);
+          STATS.loads++;
+        }
         else
           exit(1);
 
@@ -111,16 +471,23 @@ main(int argc, char *argv[])
         break;
 
       case sw:
-        state.mem[ (state.reg[regA] + offset) ] = state.reg[regB];
+        memWrite(&state, state.reg[regA] + offset, state.reg[regB]);
+        STATS.stores++;
 
         state.pc++;
         break;
 
       case beq:
-        if ( state.reg[regA] == state.reg[regB] )
+        mispredict = bpBranch(&BP, state.pc, state.reg[regA] == state.reg[regB],
+                              state.pc + 1 + offset);
+        if ( state.reg[regA] == state.reg[regB] ) {
           state.pc = (state.pc + 1 + offset);
-        else
+          STATS.beq_taken++;
+        }
+        else {
           state.pc++;
+          STATS.beq_not_taken++;
+        }
         break;
 
       case cmov:
@@ -145,6 +512,19 @@ main(int argc, char *argv[])
     }
 
     num_instr++;
+    STATS.instrs++;
+
+    if (STATS.instrs >= LIVE.next)
+      livePublish(&LIVE, state.pc, false);
+
+    if (PROF.pc != NULL && prof_pc < PROF.size) {
+      PROF.pc[prof_pc].execs++;
+      PROF.pc[prof_pc].mispredicts += mispredict;
+      PROF.pc[prof_pc].stalls += mispredict * BP.penalty;
+    }
+
+    if (stats_file != NULL && sample_interval && num_instr % sample_interval == 0)
+      printStatsSample(stats_file, num_instr == sample_interval);
   }
 
   printf("machine halted\n");
@@ -152,10 +532,177 @@ main(int argc, char *argv[])
   printf("final state of machine:\n");
   printState(&state);
 
+  if (PROF.pc != NULL)
+    writeProfile(&PROF, &state, prof_name, fold_name, fold_metric);
+
+  if (stats_file != NULL) {
+    STATS_OUT = NULL;
+    printStatsFinal(stats_file);
+    fclose(stats_file);
+  }
+
+  if (LIVE.shm != NULL)
+    livePublish(&LIVE, state.pc, true);
+
+  bpFree(&BP);
+  freeState(&state);
 
   return(0);
 }
 
+void
+usage(char *prog)
+{
+  printf("error: usage: %s <machine-code file> [options]\n", prog);
+  printf("\t-m memoryWords\tsize of simulated memory (default %d)\n", NUMMEMORY);
+  printf("\t-s statsFile\twrite performance counters as JSON on exit\n");
+  printf("\t-i interval\talso sample the counters every interval instructions\n");
+  printf("\t-q\t\tonly print the final state\n");
+  printf("\t-bp predictor\tbeq predictor: nt, btfn, bimodal, gshare, tournament\n\t\t\tor tage (default nt)\n");
+  printf("\t-bk cycles\tcycles lost per mispredicted beq (default 2)\n");
+  printf("\t-F\t\twith -q, don't pre-decode and fuse instructions\n");
+  printf("\t-k listFile\talso run every machine-code file listed, one per\n\t\t\tline, as instances in lockstep %d at a time\n", LANES);
+  printf("\t-prof file\twrite a per basic block and per pc hot spot report\n");
+  printf("\t-fold file\twrite the profile as folded stacks for flame graphs\n");
+  printf("\t-foldm instrs|misses|stalls\twhat the folded stacks count\n\t\t\t(default instrs)\n");
+  printf("\t-sym symFile\tname pcs in the profile with the assembler's -g output\n");
+  printf("\t-live file\tpublish live counters for proj2's simtop in file, best\n\t\t\tput under /dev/shm\n");
+  exit(1);
+}
+
+void
+printStatsFields(FILE *out, const char *indent)
+{
+  static const char *op_names[8] =
+      { "add", "nand", "lw", "sw", "beq", "cmov", "halt", "noop" };
+  int i;
+
+  fprintf(out, "%s\"instructions\": %lld,\n", indent, STATS.instrs);
+  fprintf(out, "%s\"opcodes\": {", indent);
+  for (i = 0; i < 8; ++i)
+    fprintf(out, "%s\"%s\": %lld", i ? ", " : " ", op_names[i], STATS.opcodes[i]);
+  fprintf(out, " },\n");
+  fprintf(out, "%s\"beq\": { \"taken\": %lld, \"not_taken\": %lld },\n",
+          indent, STATS.beq_taken, STATS.beq_not_taken);
+  fprintf(out, "%s\"loads\": %lld,\n", indent, STATS.loads);
+  fprintf(out, "%s\"stores\": %lld", indent, STATS.stores);
+}
+
+/*
+ * The stats file is a single JSON object. Interval samples are appended to
+ * its "samples" array while the program runs, the totals go in "final".
+ */
+void
+printStatsSample(FILE *out, int first)
+{
+  fprintf(out, "%s    {\n", first ? "" : ",\n");
+  printStatsFields(out, "      ");
+  fprintf(out, "\n    }");
+  fflush(out);
+}
+
+void
+printStatsFinal(FILE *out)
+{
+  fprintf(out, "\n  ],\n  \"final\": {\n");
+  printStatsFields(out, "    ");
+  fprintf(out, ",\n    \"branch_predictor\": {\n");
+  fprintf(out, "      \"kind\": \"%s\",\n", bp_names[BP.kind]);
+  fprintf(out, "      \"branches\": %lld,\n", BP.branches);
+  fprintf(out, "      \"mispredicts\": %lld,\n", BP.mispredicts);
+  fprintf(out, "      \"mpki\": %.4f,\n",
+          STATS.instrs ? 1000.0 * BP.mispredicts / STATS.instrs : 0.0);
+  fprintf(out, "      \"btb_misses\": %lld,\n", BP.btb_misses);
+  fprintf(out, "      \"penalty_cycles\": %lld\n", BP.mispredicts * BP.penalty);
+  fprintf(out, "    }");
+  if (LOCK.count) {
+    fprintf(out, ",\n    \"lockstep\": {\n");
+    fprintf(out, "      \"instances\": %d,\n", LOCK.count);
+    fprintf(out, "      \"lanes\": %d,\n", LANES);
+    fprintf(out, "      \"warps\": %lld,\n", LOCK.warps);
+    fprintf(out, "      \"steps\": %lld,\n", LOCK.steps);
+    fprintf(out, "      \"lanes_busy\": %.4f\n",
+            LOCK.steps ? (double)STATS.instrs / LOCK.steps : 0.0);
+    fprintf(out, "    }");
+  }
+  fprintf(out, "\n  }\n}\n");
+}
+
+/*
+ * atexit handler. A run that stops on an error never gets to write
+ * "final", so close the file here with the counters so far and "error"
+ * set, and it still parses.
+ */
+void
+statsAbort(void)
+{
+  if (STATS_OUT == NULL)
+    return;
+
+  fprintf(STATS_OUT, "\n  ],\n  \"error\": true,\n  \"final\": {\n");
+  printStatsFields(STATS_OUT, "    ");
+  fprintf(STATS_OUT, "\n  }\n}\n");
+  fclose(STATS_OUT);
+  STATS_OUT = NULL;
+}
+
+long long
+liveClock(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+void
+liveOpen(liveType *live, char *name, char *prog)
+{
+  int fd;
+  char *base = strrchr(prog, '/') ? strrchr(prog, '/') + 1 : prog;
+
+  /* a new file, so a viewer still mapping the last run's never sees it shrink */
+  unlink(name);
+  fd = open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+  if (fd < 0 || ftruncate(fd, sizeof(liveShared)) < 0) {
+    printf("error: can't create live stats file %s", name);
+    perror("open");
+    exit(1);
+  }
+  live->shm = mmap(NULL, sizeof(liveShared), PROT_READ | PROT_WRITE,
+                   MAP_SHARED, fd, 0);
+  close(fd);
+  if (live->shm == MAP_FAILED) {
+    printf("error: can't map live stats file %s", name);
+    perror("mmap");
+    exit(1);
+  }
+
+  live->shm->pid = getpid();
+  live->shm->start_ns = liveClock();
+  strncpy(live->shm->sim, "proj1", sizeof(live->shm->sim) - 1);
+  strncpy(live->shm->name, base, sizeof(live->shm->name) - 1);
+  __atomic_store_n(&live->shm->magic, LIVEMAGIC, __ATOMIC_RELEASE);
+  live->next = LIVEINTERVAL;
+}
+
+void
+livePublish(liveType *live, int pc, int done)
+{
+  liveShared *shm = live->shm;
+  unsigned seq = shm->seq;
+
+  __atomic_store_n(&shm->seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  shm->pc = pc;
+  shm->instrs = STATS.instrs;
+  shm->now_ns = liveClock();
+  shm->done = done;
+  __atomic_store_n(&shm->seq, seq + 2, __ATOMIC_RELEASE);
+
+  live->next = STATS.instrs + LIVEINTERVAL;
+}
+
 void
 printState(stateType *statePtr)
 {
@@ -165,7 +712,7 @@ printState(stateType *statePtr)
   printf("\tmemory:\n");
 
   for (i=0; i<statePtr->numMemory; i++) {
-    printf("\t\tmem[ %d ] %d\n", i, statePtr->mem[i]);
+    printf("\t\tmem[ %d ] %d\n", i, memRead(statePtr, i));
   }
   printf("\tregisters:\n");
 
@@ -183,4 +730,1207 @@ convertNum(int num)
     num -= ( 1 << 16 );
   } 
   return(num);
-}
\ No newline at end of file
+}
+
+/*
+ * Memory is a table of PAGESIZE-word pages. Pages are only allocated the
+ * first time they are written, an untouched page reads as all zeroes.
+ */
+void
+initMemory(stateType *statePtr, int words)
+{
+  statePtr->memSize = words;
+  statePtr->numPages = (words + PAGESIZE - 1) >> PAGESHIFT;
+  statePtr->pages = calloc(statePtr->numPages, sizeof(int *));
+
+  if (statePtr->pages == NULL) {
+    printf("error: can't allocate page table for %d words\n", words);
+    exit(1);
+  }
+}
+
+int
+memRead(stateType *statePtr, int addr)
+{
+  int *page;
+
+  if (addr < 0 || addr >= statePtr->memSize) {
+    printf("error: memory address %d out of range\n", addr);
+    exit(1);
+  }
+
+  page = statePtr->pages[addr >> PAGESHIFT];
+  if (page == NULL)
+    return 0;
+
+  return page[addr & (PAGESIZE - 1)];
+}
+
+void
+memWrite(stateType *statePtr, int addr, int val)
+{
+  int **page;
+
+  if (addr < 0 || addr >= statePtr->memSize) {
+    printf("error: memory address %d out of range\n", addr);
+    exit(1);
+  }
+
+  page = &statePtr->pages[addr >> PAGESHIFT];
+  if (*page == NULL) {
+    if (val == 0)
+      return;
+
+    *page = calloc(PAGESIZE, sizeof(int));
+    if (*page == NULL) {
+      printf("error: can't allocate page for address %d\n", addr);
+      exit(1);
+    }
+  }
+
+  (*page)[addr & (PAGESIZE - 1)] = val;
+}
+
+/*
+ * Snapshot src into dst. Only the pages src has touched are copied.
+ */
+void
+copyState(stateType *dst, stateType *src)
+{
+  int i;
+
+  *dst = *src;
+  dst->pages = calloc(src->numPages, sizeof(int *));
+  if (dst->pages == NULL) {
+    printf("error: can't allocate page table for snapshot\n");
+    exit(1);
+  }
+
+  for (i = 0; i < src->numPages; ++i) {
+    if (src->pages[i] != NULL) {
+      dst->pages[i] = malloc(PAGESIZE * sizeof(int));
+      if (dst->pages[i] == NULL) {
+        printf("error: can't allocate page for snapshot\n");
+        exit(1);
+      }
+      memcpy(dst->pages[i], src->pages[i], PAGESIZE * sizeof(int));
+    }
+  }
+}
+
+void
+freeState(stateType *statePtr)
+{
+  int i;
+
+  for (i = 0; i < statePtr->numPages; ++i)
+    free(statePtr->pages[i]);
+
+  free(statePtr->pages);
+  statePtr->pages = NULL;
+  statePtr->numPages = 0;
+}
+
+/*
+ * Returns the predictor kind called name, or -1.
+ */
+int
+bpKind(char *name)
+{
+  int i;
+
+  for (i = 0; i < NUMPREDICTORS; ++i)
+    if (!strcmp(name, bp_names[i]))
+      return i;
+  return -1;
+}
+
+void
+bpInit(predictorType *bp)
+{
+  int i;
+
+  bp->bimodal = malloc(1 << BPTABLEBITS);
+  bp->gshare = malloc(1 << BPTABLEBITS);
+  bp->chooser = malloc(1 << BPTABLEBITS);
+  memset(bp->bimodal, 1, 1 << BPTABLEBITS);
+  memset(bp->gshare, 1, 1 << BPTABLEBITS);
+  memset(bp->chooser, 1, 1 << BPTABLEBITS);
+
+  for (i = 0; i < TAGETABLES; ++i)
+    bp->tage[i] = calloc(1 << TAGEBITS, sizeof(tageEntry));
+
+  for (i = 0; i < BTBENTRIES; ++i)
+    bp->btb_pc[i] = -1;
+}
+
+void
+bpFree(predictorType *bp)
+{
+  int i;
+
+  free(bp->bimodal);
+  free(bp->gshare);
+  free(bp->chooser);
+  for (i = 0; i < TAGETABLES; ++i)
+    free(bp->tage[i]);
+}
+
+void
+counterUpdate(unsigned char *ctr, int taken)
+{
+  if (taken && *ctr < 3)
+    (*ctr)++;
+  else if (!taken && *ctr > 0)
+    (*ctr)--;
+}
+
+/*
+ * The newest len bits of history folded down to bits bits.
+ */
+unsigned int
+foldHistory(unsigned int history, int len, int bits)
+{
+  unsigned int h = (len < 32) ? history & ((1U << len) - 1) : history;
+  unsigned int folded = 0;
+
+  for ( ; h != 0; h >>= bits)
+    folded ^= h & ((1U << bits) - 1);
+  return folded;
+}
+
+/*
+ * TAGE-lite: a bimodal base predictor and TAGETABLES tagged tables
+ * indexed with geometrically longer global histories. The longest
+ * matching table provides the prediction.
+ */
+int
+tagePredict(predictorType *bp, int pc, int taken)
+{
+  unsigned int idx[TAGETABLES];
+  unsigned int tag[TAGETABLES];
+  int provider = -1;
+  int altpred;
+  int pred;
+  tageEntry *e;
+  int i;
+
+  for (i = 0; i < TAGETABLES; ++i) {
+    idx[i] = (pc ^ (pc >> TAGEBITS) ^
+              foldHistory(bp->history, tage_history[i], TAGEBITS)) &
+             ((1 << TAGEBITS) - 1);
+    tag[i] = ((pc * 7) ^ foldHistory(bp->history, tage_history[i], 8)) & 0xff;
+    tag[i] |= 0x100; /* tag 0 marks an empty entry */
+    if (bp->tage[i][idx[i]].tag == tag[i])
+      provider = i;
+  }
+
+  altpred = bp->bimodal[pc & ((1 << BPTABLEBITS) - 1)] >= 2;
+  for (i = provider - 1; i >= 0; --i) {
+    if (bp->tage[i][idx[i]].tag == tag[i]) {
+      altpred = bp->tage[i][idx[i]].ctr >= 0;
+      break;
+    }
+  }
+  pred = (provider >= 0) ? bp->tage[provider][idx[provider]].ctr >= 0 : altpred;
+
+  /* update */
+  if (provider >= 0) {
+    e = &bp->tage[provider][idx[provider]];
+    if (taken && e->ctr < 3)
+      e->ctr++;
+    else if (!taken && e->ctr > -4)
+      e->ctr--;
+    if (pred != altpred) {
+      if (pred == taken && e->useful < 3)
+        e->useful++;
+      else if (pred != taken && e->useful > 0)
+        e->useful--;
+    }
+  }
+  else
+    counterUpdate(&bp->bimodal[pc & ((1 << BPTABLEBITS) - 1)], taken);
+
+  /* on a mispredict, allocate an entry in a longer history table */
+  if (pred != taken) {
+    for (i = provider + 1; i < TAGETABLES; ++i) {
+      e = &bp->tage[i][idx[i]];
+      if (e->useful == 0) {
+        e->tag = tag[i];
+        e->ctr = taken ? 0 : -1;
+        break;
+      }
+    }
+    if (i == TAGETABLES) {
+      for (i = provider + 1; i < TAGETABLES; ++i)
+        if (bp->tage[i][idx[i]].useful > 0)
+          bp->tage[i][idx[i]].useful--;
+    }
+  }
+
+  return pred;
+}
+
+/*
+ * Predict and then train on one executed beq at pc, which went to target
+ * when taken. Returns 1 if it was mispredicted.
+ */
+int
+bpBranch(predictorType *bp, int pc, int taken, int target)
+{
+  unsigned int i = pc & ((1 << BPTABLEBITS) - 1);
+  unsigned int g = (pc ^ bp->history) & ((1 << BPTABLEBITS) - 1);
+  int b = pc & (BTBENTRIES - 1);
+  int btb_hit = (bp->btb_pc[b] == pc && bp->btb_target[b] == target);
+  int pred;
+  int p1;
+  int p2;
+
+  switch (bp->kind) {
+    case bp_nt:
+    default:
+      pred = false;
+      break;
+
+    case bp_btfn:
+      /* decided at decode from the offset, no BTB needed */
+      pred = (target <= pc);
+      btb_hit = true;
+      break;
+
+    case bp_bimodal:
+      pred = bp->bimodal[i] >= 2;
+      counterUpdate(&bp->bimodal[i], taken);
+      break;
+
+    case bp_gshare:
+      pred = bp->gshare[g] >= 2;
+      counterUpdate(&bp->gshare[g], taken);
+      break;
+
+    case bp_tournament:
+      p1 = bp->bimodal[i] >= 2;
+      p2 = bp->gshare[g] >= 2;
+      pred = (bp->chooser[i] >= 2) ? p2 : p1;
+      if (p1 != p2)
+        counterUpdate(&bp->chooser[i], p2 == taken);
+      counterUpdate(&bp->bimodal[i], taken);
+      counterUpdate(&bp->gshare[g], taken);
+      break;
+
+    case bp_tage:
+      pred = tagePredict(bp, pc, taken);
+      break;
+  }
+
+  bp->branches++;
+  bp->history = (bp->history << 1) | (taken != 0);
+
+  if (taken && pred && !btb_hit)
+    bp->btb_misses++;
+  if (taken) {
+    bp->btb_pc[b] = pc;
+    bp->btb_target[b] = target;
+  }
+
+  if (pred != taken || (taken && !btb_hit)) {
+    bp->mispredicts++;
+    return 1;
+  }
+  return 0;
+}
+
+void
+decodeWord(int instr, int *op, int *regA, int *regB, int *destR, int *offset)
+{
+  *op = ( (instr >> 22) & 7 );
+  *regA = ( (instr >> 19) & 7 );
+  *regB = ( (instr >> 16) & 7 );
+  *destR = ( (instr >> 0) & 7 );
+  *offset = convertNum( (instr >> 0) & 65535 );
+}
+
+/*
+ * Decode the word at addr into dec[addr], fusing it with the word after
+ * it when the pair is one of the idioms.
+ */
+void
+decodeAt(stateType *statePtr, decodedType *dec, int numDecoded, int addr)
+{
+  decodedType *d = &dec[addr];
+  int alu;
+
+  decodeWord(memRead(statePtr, addr), &d->op, &d->regA, &d->regB,
+             &d->destR, &d->offset);
+  d->op2 = f_none;
+
+  if (d->op == beq && d->regA == 0 && d->regB == 0) {
+    d->op = f_jump;
+    return;
+  }
+
+  /* only fuse instructions that can't fail */
+  alu = (d->op == add || d->op == nand) && d->destR != 0;
+  if (!alu || addr + 1 >= numDecoded)
+    return;
+
+  decodeWord(memRead(statePtr, addr + 1), &d->op2, &d->regA2, &d->regB2,
+             &d->destR2, &d->offset2);
+
+  if (d->op == nand && d->op2 == nand && d->destR != 0 &&
+      d->regA2 == d->destR && d->regB2 == d->destR && d->destR2 == d->destR)
+    d->op = f_and;
+  else if (d->op == add && d->op2 == add && d->destR2 != 0)
+    d->op = f_add_add;
+  else if (d->op2 == beq && d->regA2 == 0 && d->regB2 == 0)
+    d->op = (d->op == add) ? f_add_jump : f_nand_jump;
+  else
+    d->op2 = f_none;
+}
+
+/*
+ * Run the program from the pre-decoded words until it halts. Returns the
+ * number of instructions executed, a fused pair counts as two.
+ */
+int
+runDecoded(stateType *statePtr, FILE *stats_file, int sample_interval)
+{
+  decodedType *dec;
+  decodedType tmp;
+  decodedType *d;
+  int numDecoded = statePtr->numMemory;
+  int *reg = statePtr->reg;
+  int pc = statePtr->pc;
+  long long next_sample = sample_interval ? sample_interval : LLONG_MAX;
+  long long next_event;
+  int first_sample = true;
+  int addr;
+  int i;
+
+  dec = malloc((numDecoded + 1) * sizeof(decodedType));
+  for (i = 0; i < numDecoded; ++i)
+    decodeAt(statePtr, dec, numDecoded, i);
+
+  next_event = next_sample < LIVE.next ? next_sample : LIVE.next;
+
+  for (;;) {
+    if (pc >= 0 && pc < numDecoded)
+      d = &dec[pc];
+    else {
+      /* outside the program, decode as we go */
+      d = &tmp;
+      decodeWord(memRead(statePtr, pc), &d->op, &d->regA, &d->regB,
+                 &d->destR, &d->offset);
+    }
+
+    switch (d->op) {
+      case add:
+        if (d->destR == 0)
+          exit(1);
+        reg[d->destR] = reg[d->regA] + reg[d->regB];
+        STATS.opcodes[add]++;
+        pc++;
+        break;
+
+      case nand:
+        if (d->destR == 0)
+          exit(1);
+        reg[d->destR] = ~(reg[d->regA] & reg[d->regB]);
+        STATS.opcodes[nand]++;
+        pc++;
+        break;
+
+      case lw:
+        if (d->regB == 0)
+          exit(1);
+        reg[d->regB] = memRead(statePtr, reg[d->regA] + d->offset);
+        STATS.opcodes[lw]++;
+        STATS.loads++;
+        pc++;
+        break;
+
+      case sw:
+        addr = reg[d->regA] + d->offset;
+        memWrite(statePtr, addr, reg[d->regB]);
+        STATS.opcodes[sw]++;
+        STATS.stores++;
+        pc++;
+
+        /* self-modifying code, redo the decoding of the changed word */
+        if (addr >= 0 && addr < numDecoded) {
+          decodeAt(statePtr, dec, numDecoded, addr);
+          if (addr > 0)
+            decodeAt(statePtr, dec, numDecoded, addr - 1);
+        }
+        break;
+
+      case beq:
+        bpBranch(&BP, pc, reg[d->regA] == reg[d->regB], pc + 1 + d->offset);
+        STATS.opcodes[beq]++;
+        if (reg[d->regA] == reg[d->regB]) {
+          pc += 1 + d->offset;
+          STATS.beq_taken++;
+        }
+        else {
+          pc++;
+          STATS.beq_not_taken++;
+        }
+        break;
+
+      case cmov:
+        /* as in the interpreter, cmov to register 0 does nothing */
+        if (d->destR != 0) {
+          if (reg[d->regB] != 0)
+            reg[d->destR] = reg[d->regA];
+          else
+            exit(1);
+        }
+        STATS.opcodes[cmov]++;
+        pc++;
+        break;
+
+      case halt:
+        STATS.opcodes[halt]++;
+        STATS.instrs++;
+        statePtr->pc = pc + 1;
+        free(dec);
+        return STATS.instrs;
+
+      case noop:
+        STATS.opcodes[noop]++;
+        pc++;
+        break;
+
+      case f_and:
+        reg[d->destR] = reg[d->regA] & reg[d->regB];
+        STATS.opcodes[nand] += 2;
+        STATS.instrs++;
+        pc += 2;
+        break;
+
+      case f_add_add:
+        reg[d->destR] = reg[d->regA] + reg[d->regB];
+        reg[d->destR2] = reg[d->regA2] + reg[d->regB2];
+        STATS.opcodes[add] += 2;
+        STATS.instrs++;
+        pc += 2;
+        break;
+
+      case f_add_jump:
+        reg[d->destR] = reg[d->regA] + reg[d->regB];
+        STATS.opcodes[add]++;
+        bpBranch(&BP, pc + 1, true, pc + 2 + d->offset2);
+        STATS.opcodes[beq]++;
+        STATS.beq_taken++;
+        STATS.instrs++;
+        pc += 2 + d->offset2;
+        break;
+
+      case f_nand_jump:
+        reg[d->destR] = ~(reg[d->regA] & reg[d->regB]);
+        STATS.opcodes[nand]++;
+        bpBranch(&BP, pc + 1, true, pc + 2 + d->offset2);
+        STATS.opcodes[beq]++;
+        STATS.beq_taken++;
+        STATS.instrs++;
+        pc += 2 + d->offset2;
+        break;
+
+      case f_jump:
+        bpBranch(&BP, pc, true, pc + 1 + d->offset);
+        STATS.opcodes[beq]++;
+        STATS.beq_taken++;
+        pc += 1 + d->offset;
+        break;
+    }
+
+    STATS.instrs++;
+
+    /* one test for both interval samples and live updates */
+    if (STATS.instrs >= next_event) {
+      if (STATS.instrs >= next_sample) {
+        if (stats_file != NULL)
+          printStatsSample(stats_file, first_sample);
+        first_sample = false;
+        next_sample += sample_interval;
+      }
+      if (STATS.instrs >= LIVE.next)
+        livePublish(&LIVE, pc, false);
+      next_event = next_sample < LIVE.next ? next_sample : LIVE.next;
+    }
+  }
+}
+
+/*
+ * Lockstep mode.
+ */
+void
+lockLoad(lockstepType *ls, char *name)
+{
+  char line[MAXLINELENGTH];
+  instanceType *inst;
+  FILE *filePtr;
+  int word;
+
+  if (ls->count % 64 == 0) {
+    ls->inst = realloc(ls->inst, (ls->count + 64) * sizeof(instanceType));
+    if (ls->inst == NULL) {
+      printf("error: can't allocate %d instances\n", ls->count + 64);
+      exit(1);
+    }
+  }
+  inst = &ls->inst[ls->count++];
+  memset(inst, 0, sizeof(*inst));
+  inst->name = strdup(name);
+  inst->image = malloc(ls->mem_size * sizeof(int));
+  if (inst->image == NULL) {
+    printf("error: can't allocate memory for %s\n", name);
+    exit(1);
+  }
+
+  filePtr = fopen(name, "r");
+  if (filePtr == NULL) {
+    printf("error: can't open file %s", name);
+    perror("fopen");
+    exit(1);
+  }
+  for ( ; fgets(line, MAXLINELENGTH, filePtr) != NULL; inst->size++) {
+    if (sscanf(line, "%d", &word) != 1 || inst->size >= ls->mem_size) {
+      printf("error in reading address %d of %s\n", inst->size, name);
+      exit(1);
+    }
+    inst->image[inst->size] = word;
+  }
+  fclose(filePtr);
+}
+
+/*
+ * Add an instance for every machine-code file named in listName.
+ */
+void
+lockList(lockstepType *ls, char *listName)
+{
+  char line[MAXLINELENGTH];
+  char name[MAXLINELENGTH];
+  FILE *filePtr;
+
+  filePtr = fopen(listName, "r");
+  if (filePtr == NULL) {
+    printf("error: can't open file %s", listName);
+    perror("fopen");
+    exit(1);
+  }
+  while (fgets(line, MAXLINELENGTH, filePtr) != NULL) {
+    if (sscanf(line, "%s", name) == 1)
+      lockLoad(ls, name);
+  }
+  fclose(filePtr);
+}
+
+/*
+ * Lane l's word at addr, NULL if addr is out of range.
+ */
+int *
+lockWord(lockstepType *ls, int addr, int l)
+{
+  if (addr < 0 || addr >= ls->mem_size)
+    return NULL;
+  return &ls->mem[addr * LANES + l];
+}
+
+/*
+ * Stop lane l of the warp starting at instance first. The lane is taken
+ * out of live and act at the end of the step, so it stays at its pc.
+ */
+#define LOCKSTOP(l, why) \
+  (stop[l] = -1, stopping = true, ls->inst[first + (l)].error = (why))
+
+/*
+ * Lane masks are built with shifts rather than vector compares, which GCC
+ * only turns into vector code when the target has vectors of LANES ints.
+ * LANES_LT needs x - y not to overflow. Horizontal reductions fold the
+ * halves together as narrower vectors to stay in registers.
+ */
+#define LANES_EQ(x, y) (~((((x) ^ (y)) | -((x) ^ (y))) >> 31))
+#define LANES_LT(x, y) (((x) - (y)) >> 31)
+
+typedef int halfLanes __attribute__ ((vector_size (LANES / 2 * sizeof(int))));
+typedef int quarterLanes __attribute__ ((vector_size (LANES / 4 * sizeof(int))));
+
+static inline quarterLanes
+lanesQuarters(lanes *v, int op)
+{
+  halfLanes h0, h1, hlt;
+  quarterLanes q0, q1, qlt;
+
+  memcpy(&h0, v, sizeof(h0));
+  memcpy(&h1, (char *)v + sizeof(h0), sizeof(h1));
+  hlt = LANES_LT(h0, h1);
+  h0 = op == '<' ? (hlt & h0) | (~hlt & h1) : op == '+' ? h0 + h1 : h0 | h1;
+  memcpy(&q0, &h0, sizeof(q0));
+  memcpy(&q1, (char *)&h0 + sizeof(q0), sizeof(q1));
+  qlt = LANES_LT(q0, q1);
+  return op == '<' ? (qlt & q0) | (~qlt & q1) : op == '+' ? q0 + q1 : q0 | q1;
+}
+
+static inline int
+lanesMin(lanes *v)
+{
+  quarterLanes q = lanesQuarters(v, '<');
+  int m = q[0];
+  int i;
+
+  for (i = 1; i < LANES / 4; ++i)
+    m = q[i] < m ? q[i] : m;
+  return m;
+}
+
+static inline int
+lanesSum(lanes *v)
+{
+  quarterLanes q = lanesQuarters(v, '+');
+  int m = q[0];
+  int i;
+
+  for (i = 1; i < LANES / 4; ++i)
+    m += q[i];
+  return m;
+}
+
+static inline int
+lanesOr(lanes *v)
+{
+  quarterLanes q = lanesQuarters(v, '|');
+  int m = q[0];
+  int i;
+
+  for (i = 1; i < LANES / 4; ++i)
+    m |= q[i];
+  return m;
+}
+
+/*
+ * Run instances first .. first + LANES - 1 until they all halt.
+ */
+__attribute__ ((target_clones ("avx512f", "default")))
+void
+lockWarp(lockstepType *ls, int first)
+{
+  lanes reg[NUMREGS];
+  lanes pc;
+  lanes live; /* -1 in lanes still running */
+  lanes act; /* -1 in lanes running this step */
+  lanes taken;
+  lanes at;
+  lanes words;
+  lanes tmp;
+  lanes count;
+  lanes stop; /* -1 in lanes stopped on an error this step */
+  lanes zero = { 0 };
+  instanceType *inst;
+  int *word;
+  int stopping = false;
+  int n = ls->count - first < LANES ? ls->count - first : LANES;
+  int used = 0; /* words that have to be cleared afterwards */
+  int opcode;
+  int regA;
+  int regB;
+  int destR;
+  int offset;
+  int instr;
+  int min_pc;
+  int active;
+  int addr;
+  int a;
+  int l;
+
+  for (l = 0; l < LANES; ++l) {
+    live[l] = l < n ? -1 : 0;
+    if (l >= n)
+      continue;
+    inst = &ls->inst[first + l];
+    for (a = 0; a < inst->size; ++a)
+      ls->mem[a * LANES + l] = inst->image[a];
+    if (inst->size > used)
+      used = inst->size;
+  }
+  for (a = 0; a < NUMREGS; ++a)
+    reg[a] = zero;
+  pc = zero;
+  count = zero;
+  stop = zero;
+
+  for (;;) {
+    tmp = (live & pc) | (~live & (zero + NOPC));
+    min_pc = lanesMin(&tmp);
+    if (min_pc == NOPC)
+      break;
+
+    /*
+     * Lanes at min_pc normally all hold the same word, so or-ing them
+     * gives it. If they don't, the first lane's word runs now and the
+     * other lanes wait for a later step.
+     */
+    at = live & LANES_EQ(pc, zero + min_pc);
+    if ( (word = lockWord(ls, min_pc, 0)) == NULL ) {
+      for (l = 0; l < LANES; ++l) {
+        if (at[l])
+          LOCKSTOP(l, "pc out of range");
+      }
+      live &= ~at;
+      stop = zero;
+      stopping = false;
+      continue;
+    }
+    memcpy(&words, word, sizeof(words));
+    tmp = words & at;
+    instr = lanesOr(&tmp);
+    act = at & LANES_EQ(words, zero + instr);
+    if ( (active = -lanesSum(&act)) == 0 ) {
+      for (l = 0; !at[l]; ++l)
+        ;
+      instr = words[l];
+      act = at & LANES_EQ(words, zero + instr);
+      active = -lanesSum(&act);
+    }
+
+    opcode = ( (instr >> 22) & 7 );
+    regA = ( (instr >> 19) & 7 );
+    regB = ( (instr >> 16) & 7 );
+    destR = ( (instr >> 0) & 7 );
+    offset = convertNum( (instr >> 0) & 65535 );
+
+    ls->steps++;
+    STATS.opcodes[opcode] += active;
+    STATS.instrs += active;
+    count -= act;
+
+    switch (opcode) {
+      case add:
+        if (destR == 0) {
+          for (l = 0; l < LANES; ++l) {
+            if (act[l])
+              LOCKSTOP(l, "add to register 0");
+          }
+          break;
+        }
+        reg[destR] = (act & (reg[regA] + reg[regB])) | (~act & reg[destR]);
+        break;
+
+      case nand:
+        if (destR == 0) {
+          for (l = 0; l < LANES; ++l) {
+            if (act[l])
+              LOCKSTOP(l, "nand to register 0");
+          }
+          break;
+        }
+        reg[destR] = (act & ~(reg[regA] & reg[regB])) | (~act & reg[destR]);
+        break;
+
+      case lw:
+        for (l = 0; l < LANES; ++l) {
+          if (!act[l])
+            continue;
+          if (regB == 0)
+            LOCKSTOP(l, "lw to register 0");
+          else if ( (word = lockWord(ls, reg[regA][l] + offset, l)) == NULL )
+            LOCKSTOP(l, "memory address out of range");
+          else
+            reg[regB][l] = *word;
+        }
+        STATS.loads += active;
+        break;
+
+      case sw:
+        for (l = 0; l < LANES; ++l) {
+          if (!act[l])
+            continue;
+          addr = reg[regA][l] + offset;
+          if ( (word = lockWord(ls, addr, l)) == NULL ) {
+            LOCKSTOP(l, "memory address out of range");
+            continue;
+          }
+          *word = reg[regB][l];
+          if (addr >= used)
+            used = addr + 1;
+        }
+        STATS.stores += active;
+        break;
+
+      case beq:
+        taken = act & LANES_EQ(reg[regA], reg[regB]);
+        pc += taken & (zero + offset);
+        a = -lanesSum(&taken);
+        STATS.beq_taken += a;
+        STATS.beq_not_taken += active - a;
+        break;
+
+      case cmov:
+        /*
+         * like the interpreter, cmov to register 0 does nothing and one
+         * that doesn't move stops the lane
+         */
+        if (destR == 0)
+          break;
+        tmp = act & LANES_EQ(reg[regB], zero);
+        if (lanesOr(&tmp)) {
+          for (l = 0; l < LANES; ++l) {
+            if (tmp[l])
+              LOCKSTOP(l, "cmov that didn't move");
+          }
+          act &= ~tmp;
+        }
+        reg[destR] = (act & reg[regA]) | (~act & reg[destR]);
+        break;
+
+      case halt:
+        live &= ~act;
+        break;
+    }
+
+    if (stopping) {
+      live &= ~stop;
+      act &= ~stop;
+      stop = zero;
+      stopping = false;
+    }
+    pc -= act;
+  }
+
+  for (l = 0; l < n; ++l) {
+    inst = &ls->inst[first + l];
+    inst->instrs = count[l];
+    inst->pc = pc[l];
+    for (a = 0; a < NUMREGS; ++a)
+      inst->reg[a] = reg[a][l];
+  }
+  memset(ls->mem, 0, used * LANES * sizeof(int));
+  ls->warps++;
+}
+
+/*
+ * Run every instance and print how each ended. Returns how many were
+ * stopped on an error.
+ */
+int
+runLockstep(lockstepType *ls)
+{
+  instanceType *inst;
+  int stopped = 0;
+  int first;
+  int i;
+  int r;
+
+  ls->mem = calloc((size_t)ls->mem_size * LANES, sizeof(int));
+  if (ls->mem == NULL) {
+    printf("error: can't allocate %d words for each of %d lanes\n",
+           ls->mem_size, LANES);
+    exit(1);
+  }
+
+  for (first = 0; first < ls->count; first += LANES)
+    lockWarp(ls, first);
+
+  for (i = 0; i < ls->count; ++i) {
+    inst = &ls->inst[i];
+    printf("%s: ", inst->name);
+    if (inst->error != NULL) {
+      printf("stopped by %s, ", inst->error);
+      stopped++;
+    }
+    printf("%lld instructions, pc %d, registers", inst->instrs, inst->pc);
+    for (r = 0; r < NUMREGS; ++r)
+      printf(" %d", inst->reg[r]);
+    printf("\n");
+  }
+  printf("total of %lld instructions executed by %d instances in %lld steps\n",
+         STATS.instrs, ls->count, ls->steps);
+  printf("%.2f of %d lanes busy per step\n",
+         ls->steps ? (double)STATS.instrs / ls->steps : 0.0, LANES);
+  if (stopped)
+    printf("%d instances stopped on an error\n", stopped);
+  free(ls->mem);
+  return stopped;
+}
+
+/*
+ * Profiler.
+ */
+void
+profInit(profileType *prof, int size, char *name)
+{
+  prof->size = size;
+  prof->pc = calloc(size, sizeof(profEntry));
+  prof->line = calloc(size, sizeof(int));
+  prof->label = calloc(size, sizeof(char *));
+  prof->leader = calloc(size, sizeof(int));
+  if (prof->pc == NULL || prof->line == NULL || prof->label == NULL ||
+      prof->leader == NULL) {
+    printf("error: can't allocate profile for %d words\n", size);
+    exit(1);
+  }
+
+  prof->name = strrchr(name, '/') ? strrchr(name, '/') + 1 : name;
+}
+
+void
+profSymbols(profileType *prof, char *symName)
+{
+  char line[MAXLINELENGTH];
+  char label[MAXLINELENGTH];
+  FILE *symFile;
+  int addr;
+  int src;
+  int n;
+
+  symFile = fopen(symName, "r");
+  if (symFile == NULL) {
+    printf("error: can't open symbol file %s", symName);
+    perror("fopen");
+    exit(1);
+  }
+
+  while (fgets(line, MAXLINELENGTH, symFile) != NULL) {
+    n = sscanf(line, "%d %d %s", &addr, &src, label);
+    if (n < 2) {
+      printf("error: bad line in symbol file %s: %s", symName, line);
+      exit(1);
+    }
+    if (addr < 0 || addr >= prof->size)
+      continue;
+    prof->line[addr] = src;
+    if (n == 3)
+      prof->label[addr] = strdup(label);
+  }
+  fclose(symFile);
+}
+
+/*
+ * Name pc by the closest label at or before it, "loop" or "loop+3".
+ */
+char *
+profWhere(profileType *prof, int pc, char *buf)
+{
+  int l;
+
+  for (l = pc; l >= 0 && prof->label[l] == NULL; --l)
+    ;
+  if (l < 0)
+    sprintf(buf, "pc%d", pc);
+  else if (l == pc)
+    sprintf(buf, "%s", prof->label[l]);
+  else
+    sprintf(buf, "%s+%d", prof->label[l], pc - l);
+  return buf;
+}
+
+/*
+ * Basic blocks start at 0, at every label, and after and at the target
+ * of every beq that was executed.
+ */
+void
+profBlocks(profileType *prof, stateType *statePtr)
+{
+  int pc;
+  int instr;
+  int target;
+
+  prof->leader[0] = true;
+  for (pc = 0; pc < prof->size; ++pc) {
+    if (prof->label[pc] != NULL)
+      prof->leader[pc] = true;
+
+    instr = memRead(statePtr, pc);
+    if (prof->pc[pc].execs == 0 || ((instr >> 22) & 7) != beq)
+      continue;
+
+    target = pc + 1 + convertNum(instr & 65535);
+    if (pc + 1 < prof->size)
+      prof->leader[pc + 1] = true;
+    if (target >= 0 && target < prof->size)
+      prof->leader[target] = true;
+  }
+}
+
+/* a basic block or a single word in the profile report */
+typedef struct profRowStruct {
+  int first;
+  int last;
+  long long instrs;
+  profEntry e; /* e.execs counts runs of the first word */
+} profRow;
+
+long long
+profCost(profRow *r)
+{
+  return r->e.imisses + r->e.dmisses + r->e.stalls;
+}
+
+int
+byInstrs(const void *a, const void *b)
+{
+  const profRow *x = a;
+  const profRow *y = b;
+
+  if (x->instrs != y->instrs)
+    return x->instrs < y->instrs ? 1 : -1;
+  return x->first - y->first;
+}
+
+int
+byCost(const void *a, const void *b)
+{
+  profRow *x = (profRow *)a;
+  profRow *y = (profRow *)b;
+
+  if (profCost(x) != profCost(y))
+    return profCost(x) < profCost(y) ? 1 : -1;
+  return byInstrs(a, b);
+}
+
+void
+printProfileRow(FILE *out, profileType *prof, profRow *r, long long total)
+{
+  char where[MAXLINELENGTH];
+  char range[64];
+
+  if (!prof->line[r->first] || !prof->line[r->last])
+    sprintf(range, "-");
+  else if (r->first == r->last)
+    sprintf(range, "%d", prof->line[r->first]);
+  else
+    sprintf(range, "%d-%d", prof->line[r->first], prof->line[r->last]);
+
+  fprintf(out, "  %-16s %5d %-9s %10lld %10lld %6.2f%% %8lld %8lld %8lld %8lld\n",
+          profWhere(prof, r->first, where), r->first, range, r->e.execs,
+          r->instrs, total ? 100.0 * r->instrs / total : 0.0, r->e.imisses,
+          r->e.dmisses, r->e.mispredicts, r->e.stalls);
+}
+
+/*
+ * The hot spot report: basic blocks by instructions executed, then the
+ * words that cost the most cache misses and stall cycles. profBlocks has
+ * to have been run first, as for printFolded.
+ */
+void
+printProfile(profileType *prof, FILE *out)
+{
+  profRow *blocks;
+  profRow *words;
+  profRow *r;
+  long long total = 0;
+  int nblocks = 0;
+  int nwords = 0;
+  int pc;
+  int i;
+
+  blocks = calloc(prof->size, sizeof(profRow));
+  words = calloc(prof->size, sizeof(profRow));
+
+  r = blocks;
+  for (pc = 0; pc < prof->size; ++pc) {
+    profEntry *e = &prof->pc[pc];
+
+    if (prof->leader[pc] || nblocks == 0) {
+      r = &blocks[nblocks++];
+      r->first = pc;
+      r->e.execs = e->execs;
+    }
+    r->last = pc;
+    r->instrs += e->execs;
+    r->e.imisses += e->imisses;
+    r->e.dmisses += e->dmisses;
+    r->e.mispredicts += e->mispredicts;
+    r->e.stalls += e->stalls;
+    total += e->execs;
+
+    if (e->execs) {
+      words[nwords].first = words[nwords].last = pc;
+      words[nwords].instrs = e->execs;
+      words[nwords++].e = *e;
+    }
+  }
+
+  qsort(blocks, nblocks, sizeof(profRow), byInstrs);
+  qsort(words, nwords, sizeof(profRow), byCost);
+
+  fprintf(out, "profile of %s: %lld instructions\n\n", prof->name, total);
+  fprintf(out, "basic blocks by instructions executed\n");
+  fprintf(out, "  %-16s %5s %-9s %10s %10s %7s %8s %8s %8s %8s\n", "block",
+          "pc", "lines", "entries", "instrs", "%", "imisses", "dmisses",
+          "mispred", "stalls");
+  for (i = 0; i < nblocks && blocks[i].instrs; ++i)
+    printProfileRow(out, prof, &blocks[i], total);
+
+  fprintf(out, "\ninstructions by cache misses and stall cycles\n");
+  fprintf(out, "  %-16s %5s %-9s %10s %10s %7s %8s %8s %8s %8s\n", "where",
+          "pc", "line", "execs", "instrs", "%", "imisses", "dmisses",
+          "mispred", "stalls");
+  for (i = 0; i < nwords && i < 20; ++i)
+    printProfileRow(out, prof, &words[i], total);
+
+  free(blocks);
+  free(words);
+}
+
+/*
+ * Folded stacks for flame graph tools, "program;block;word count" for
+ * every word that was run, counting metric.
+ */
+void
+printFolded(profileType *prof, FILE *out, int metric)
+{
+  char block[MAXLINELENGTH];
+  char where[MAXLINELENGTH];
+  profEntry *e;
+  long long count;
+  int first = 0;
+  int pc;
+
+  for (pc = 0; pc < prof->size; ++pc) {
+    if (prof->leader[pc])
+      first = pc;
+
+    e = &prof->pc[pc];
+    if (metric == fold_misses)
+      count = e->imisses + e->dmisses;
+    else if (metric == fold_stalls)
+      count = e->stalls;
+    else
+      count = e->execs;
+
+    if (count)
+      fprintf(out, "%s;%s;%s %lld\n", prof->name, profWhere(prof, first, block),
+              profWhere(prof, pc, where), count);
+  }
+}
+
+void
+writeProfile(profileType *prof, stateType *statePtr, char *prof_name,
+    char *fold_name, int fold_metric)
+{
+  FILE *out;
+
+  profBlocks(prof, statePtr);
+
+  if (prof_name != NULL) {
+    if ( (out = fopen(prof_name, "w")) == NULL ) {
+      printf("error: can't open profile %s", prof_name);
+      perror("fopen");
+      exit(1);
+    }
+    printProfile(prof, out);
+    fclose(out);
+  }
+
+  if (fold_name != NULL) {
+    if ( (out = fopen(fold_name, "w")) == NULL ) {
+      printf("error: can't open folded stacks %s", fold_name);
+      perror("fopen");
+      exit(1);
+    }
+    printFolded(prof, out, fold_metric);
+    fclose(out);
+  }
+}
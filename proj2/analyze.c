@@ -0,0 +1,631 @@
+/*
+ * Static cache analysis for LC3101 programs. Without running the
+ * program, classifies the fetch of every instruction, and every lw or sw
+ * whose address is constant (regA is 0), for an LRU cache of the given
+ * geometry, the same cache the simulator models:
+ *
+ *     always-hit: the block is in the cache on every execution
+ *     always-miss: the block is never in the cache
+ *     first-miss: at most the first execution misses
+ *     unknown: none of the above could be shown
+ *
+ * Must and may analyses (Ferdinand) run over the control-flow graph, with
+ * beq having both pc + 1 and its target as successors. For every known
+ * block the must cache keeps the oldest LRU age it can have and the may
+ * cache the youngest, ages of ways or more meaning not cached. An access
+ * to a block the analysis can't work out might touch any set, so it ages
+ * every block in the must cache and leaves every block possibly cached.
+ * First-miss comes from a set touching no more known blocks than it has
+ * ways, as long as there are no unknown accesses. Code is assumed not to
+ * be modified.
+ *
+ * -check reads a profile written by the simulator's -prof for the same
+ * program and geometry and reports every access whose classification the
+ * run contradicts.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NUMMEMORY 65536
+#define MAXLINELENGTH 1000
+
+enum { add, nand, lw, sw, beq, cmov, halt, noop };
+enum { false, true };
+enum { c_unreached, c_always_hit, c_always_miss, c_first_miss, c_unknown,
+       c_none, NUMCLASSES };
+
+static const char *class_names[NUMCLASSES] =
+    { "unreached", "always-hit", "always-miss", "first-miss", "unknown", "-" };
+
+typedef struct analysisStruct {
+  int b_size;
+  int n_sets;
+  int ways;
+
+  int size; /* words of program */
+  int *mem;
+  char **label; /* from the -g symbol file */
+  int *line;
+
+  int blocks; /* known blocks, numbered 0 .. blocks - 1 */
+  int *block_id; /* per memory block, -1 if never accessed by a known address */
+  int *block_of; /* memory block of each known block */
+  int **set_blocks; /* known blocks of each set */
+  int *set_count;
+
+  int *fetch_block; /* known block of each pc */
+  int *data_block; /* known block of its lw or sw, -1 if unknown or none */
+
+  int *reached;
+  unsigned short *must; /* blocks ages for each pc, before the fetch */
+  unsigned short *may;
+  unsigned short *work_must;
+  unsigned short *work_may;
+
+  int *fetch_class;
+  int *data_class;
+} analysisType;
+
+analysisType AN;
+
+void usage(char *);
+int convertNum(int);
+
+int
+convertNum(int num)
+{
+  /* convert a 16-bit number into a 32-bit Sun integer */
+  if (num & ( 1 << 15 ) ) {
+    num -= ( 1 << 16 );
+  }
+  return(num);
+}
+
+void
+loadProgram(analysisType *an, char *name)
+{
+  char line[MAXLINELENGTH];
+  FILE *filePtr;
+  int word;
+
+  filePtr = fopen(name, "r");
+  if (filePtr == NULL) {
+    printf("error: can't open file %s", name);
+    perror("fopen");
+    exit(1);
+  }
+
+  an->mem = malloc(NUMMEMORY * sizeof(int));
+  for (an->size = 0; fgets(line, MAXLINELENGTH, filePtr) != NULL; an->size++) {
+    if (sscanf(line, "%d", &word) != 1 || an->size >= NUMMEMORY) {
+      printf("error in reading address %d\n", an->size);
+      exit(1);
+    }
+    an->mem[an->size] = word;
+  }
+  fclose(filePtr);
+
+  an->label = calloc(an->size, sizeof(char *));
+  an->line = calloc(an->size, sizeof(int));
+}
+
+void
+loadSymbols(analysisType *an, char *symName)
+{
+  char line[MAXLINELENGTH];
+  char label[MAXLINELENGTH];
+  FILE *symFile;
+  int addr;
+  int src;
+  int n;
+
+  symFile = fopen(symName, "r");
+  if (symFile == NULL) {
+    printf("error: can't open symbol file %s", symName);
+    perror("fopen");
+    exit(1);
+  }
+
+  while (fgets(line, MAXLINELENGTH, symFile) != NULL) {
+    n = sscanf(line, "%d %d %s", &addr, &src, label);
+    if (n < 2) {
+      printf("error: bad line in symbol file %s: %s", symName, line);
+      exit(1);
+    }
+    if (addr < 0 || addr >= an->size)
+      continue;
+    an->line[addr] = src;
+    if (n == 3)
+      an->label[addr] = strdup(label);
+  }
+  fclose(symFile);
+}
+
+/*
+ * Name pc by the closest label at or before it, "loop" or "loop+3".
+ */
+char *
+where(analysisType *an, int pc, char *buf)
+{
+  int l;
+
+  for (l = pc; l >= 0 && an->label[l] == NULL; --l)
+    ;
+  if (l < 0)
+    sprintf(buf, "pc%d", pc);
+  else if (l == pc)
+    sprintf(buf, "%s", an->label[l]);
+  else
+    sprintf(buf, "%s+%d", an->label[l], pc - l);
+  return buf;
+}
+
+/*
+ * Known block for the word at addr, numbering it the first time.
+ */
+int
+knownBlock(analysisType *an, int addr)
+{
+  int b = addr / an->b_size;
+
+  if (an->block_id[b] < 0) {
+    an->block_of[an->blocks] = b;
+    an->block_id[b] = an->blocks++;
+  }
+  return an->block_id[b];
+}
+
+int
+dataAddr(int instr, int *addr)
+{
+  int opcode = (instr >> 22) & 7;
+
+  if (opcode != lw && opcode != sw)
+    return false;
+  *addr = ((instr >> 19) & 7) == 0 ? convertNum(instr & 65535) : -1;
+  return true;
+}
+
+void
+initAnalysis(analysisType *an)
+{
+  int n_blocks = NUMMEMORY / an->b_size + 1;
+  int addr;
+  int pc;
+  int b;
+  int s;
+
+  an->block_id = malloc(n_blocks * sizeof(int));
+  an->block_of = malloc(n_blocks * sizeof(int));
+  for (b = 0; b < n_blocks; ++b)
+    an->block_id[b] = -1;
+
+  an->fetch_block = malloc(an->size * sizeof(int));
+  an->data_block = malloc(an->size * sizeof(int));
+  for (pc = 0; pc < an->size; ++pc) {
+    an->fetch_block[pc] = knownBlock(an, pc);
+    an->data_block[pc] = -1;
+    if (dataAddr(an->mem[pc], &addr) && addr >= 0 && addr < NUMMEMORY)
+      an->data_block[pc] = knownBlock(an, addr);
+  }
+
+  an->set_count = calloc(an->n_sets, sizeof(int));
+  an->set_blocks = malloc(an->n_sets * sizeof(int *));
+  for (b = 0; b < an->blocks; ++b)
+    an->set_count[an->block_of[b] % an->n_sets]++;
+  for (s = 0; s < an->n_sets; ++s) {
+    an->set_blocks[s] = malloc((an->set_count[s] + 1) * sizeof(int));
+    an->set_count[s] = 0;
+  }
+  for (b = 0; b < an->blocks; ++b) {
+    s = an->block_of[b] % an->n_sets;
+    an->set_blocks[s][an->set_count[s]++] = b;
+  }
+
+  an->reached = calloc(an->size, sizeof(int));
+  an->must = malloc((size_t)an->size * an->blocks * sizeof(unsigned short));
+  an->may = malloc((size_t)an->size * an->blocks * sizeof(unsigned short));
+  an->work_must = malloc(an->blocks * sizeof(unsigned short));
+  an->work_may = malloc(an->blocks * sizeof(unsigned short));
+  an->fetch_class = malloc(an->size * sizeof(int));
+  an->data_class = malloc(an->size * sizeof(int));
+  if (an->must == NULL || an->may == NULL) {
+    printf("error: can't allocate cache states for %d words and %d blocks\n",
+           an->size, an->blocks);
+    exit(1);
+  }
+}
+
+/*
+ * LRU update of the must and may caches for an access to known block b.
+ */
+void
+lruAccess(analysisType *an, unsigned short *must, unsigned short *may, int b)
+{
+  int s = an->block_of[b] % an->n_sets;
+  int old_must = must[b];
+  int old_may = may[b];
+  int c;
+  int i;
+
+  for (i = 0; i < an->set_count[s]; ++i) {
+    c = an->set_blocks[s][i];
+    if (c == b)
+      continue;
+    if (must[c] < old_must)
+      must[c]++;
+    if (may[c] <= old_may && may[c] < an->ways)
+      may[c]++;
+  }
+  must[b] = 0;
+  may[b] = 0;
+}
+
+/*
+ * An access to an address that isn't known.
+ */
+void
+lruUnknown(analysisType *an, unsigned short *must, unsigned short *may)
+{
+  int c;
+
+  for (c = 0; c < an->blocks; ++c) {
+    if (must[c] < an->ways)
+      must[c]++;
+    may[c] = 0;
+  }
+}
+
+/*
+ * Join the state after an instruction into the state before pc, returning
+ * whether that changed it.
+ */
+int
+join(analysisType *an, int pc, unsigned short *must, unsigned short *may)
+{
+  unsigned short *to_must = &an->must[(size_t)pc * an->blocks];
+  unsigned short *to_may = &an->may[(size_t)pc * an->blocks];
+  int changed = false;
+  int c;
+
+  if (!an->reached[pc]) {
+    an->reached[pc] = true;
+    memcpy(to_must, must, an->blocks * sizeof(unsigned short));
+    memcpy(to_may, may, an->blocks * sizeof(unsigned short));
+    return true;
+  }
+
+  for (c = 0; c < an->blocks; ++c) {
+    if (must[c] > to_must[c]) {
+      to_must[c] = must[c];
+      changed = true;
+    }
+    if (may[c] < to_may[c]) {
+      to_may[c] = may[c];
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+/*
+ * Run the must and may analyses to a fixed point, starting from an empty
+ * cache at pc 0.
+ */
+void
+analyse(analysisType *an)
+{
+  unsigned short *must = an->work_must;
+  unsigned short *may = an->work_may;
+  int changed;
+  int instr;
+  int opcode;
+  int regA;
+  int regB;
+  int succ[2];
+  int n_succ;
+  int pc;
+  int c;
+  int i;
+
+  for (c = 0; c < an->blocks; ++c) {
+    must[c] = an->ways;
+    may[c] = an->ways;
+  }
+  if (an->size > 0)
+    join(an, 0, must, may);
+
+  do {
+    changed = false;
+    for (pc = 0; pc < an->size; ++pc) {
+      if (!an->reached[pc])
+        continue;
+
+      memcpy(must, &an->must[(size_t)pc * an->blocks], an->blocks * sizeof(unsigned short));
+      memcpy(may, &an->may[(size_t)pc * an->blocks], an->blocks * sizeof(unsigned short));
+
+      instr = an->mem[pc];
+      opcode = (instr >> 22) & 7;
+      regA = (instr >> 19) & 7;
+      regB = (instr >> 16) & 7;
+
+      lruAccess(an, must, may, an->fetch_block[pc]);
+      if (an->data_block[pc] >= 0)
+        lruAccess(an, must, may, an->data_block[pc]);
+      else if (opcode == lw || opcode == sw)
+        lruUnknown(an, must, may);
+
+      n_succ = 0;
+      if (opcode == beq) {
+        succ[n_succ++] = pc + 1 + convertNum(instr & 65535);
+        if (regA != regB)
+          succ[n_succ++] = pc + 1;
+      }
+      else if (opcode != halt)
+        succ[n_succ++] = pc + 1;
+
+      for (i = 0; i < n_succ; ++i) {
+        if (succ[i] >= 0 && succ[i] < an->size && join(an, succ[i], must, may))
+          changed = true;
+      }
+    }
+  } while (changed);
+}
+
+/*
+ * Classify every access from the state before each reached pc.
+ */
+void
+classify(analysisType *an)
+{
+  unsigned short *must = an->work_must;
+  unsigned short *may = an->work_may;
+  int *persistent;
+  int *used;
+  int unknown = false;
+  int opcode;
+  int pc;
+  int b;
+  int s;
+
+  /* a set is persistent if every known block it ever holds fits at once */
+  used = calloc(an->blocks, sizeof(int));
+  persistent = malloc(an->n_sets * sizeof(int));
+  for (pc = 0; pc < an->size; ++pc) {
+    if (!an->reached[pc])
+      continue;
+    used[an->fetch_block[pc]] = true;
+    if (an->data_block[pc] >= 0)
+      used[an->data_block[pc]] = true;
+    else if (dataAddr(an->mem[pc], &b))
+      unknown = true;
+  }
+  for (s = 0; s < an->n_sets; ++s)
+    persistent[s] = 0;
+  for (b = 0; b < an->blocks; ++b)
+    persistent[an->block_of[b] % an->n_sets] += used[b];
+  for (s = 0; s < an->n_sets; ++s)
+    persistent[s] = !unknown && persistent[s] <= an->ways;
+
+  for (pc = 0; pc < an->size; ++pc) {
+    opcode = (an->mem[pc] >> 22) & 7;
+    if (!an->reached[pc]) {
+      an->fetch_class[pc] = c_unreached;
+      an->data_class[pc] = (opcode == lw || opcode == sw) ? c_unreached : c_none;
+      continue;
+    }
+
+    memcpy(must, &an->must[(size_t)pc * an->blocks], an->blocks * sizeof(unsigned short));
+    memcpy(may, &an->may[(size_t)pc * an->blocks], an->blocks * sizeof(unsigned short));
+
+    b = an->fetch_block[pc];
+    if (must[b] < an->ways)
+      an->fetch_class[pc] = c_always_hit;
+    else if (may[b] >= an->ways)
+      an->fetch_class[pc] = c_always_miss;
+    else if (persistent[an->block_of[b] % an->n_sets])
+      an->fetch_class[pc] = c_first_miss;
+    else
+      an->fetch_class[pc] = c_unknown;
+    lruAccess(an, must, may, b);
+
+    b = an->data_block[pc];
+    if (opcode != lw && opcode != sw)
+      an->data_class[pc] = c_none;
+    else if (b < 0)
+      an->data_class[pc] = c_unknown;
+    else if (must[b] < an->ways)
+      an->data_class[pc] = c_always_hit;
+    else if (may[b] >= an->ways)
+      an->data_class[pc] = c_always_miss;
+    else if (persistent[an->block_of[b] % an->n_sets])
+      an->data_class[pc] = c_first_miss;
+    else
+      an->data_class[pc] = c_unknown;
+  }
+  free(used);
+  free(persistent);
+}
+
+void
+printAnalysis(analysisType *an, char *name)
+{
+  long long fetch_counts[NUMCLASSES];
+  long long data_counts[NUMCLASSES];
+  char buf[MAXLINELENGTH];
+  char src[32];
+  int pc;
+  int k;
+
+  memset(fetch_counts, 0, sizeof(fetch_counts));
+  memset(data_counts, 0, sizeof(data_counts));
+
+  printf("cache analysis of %s: %d words, %d-word blocks, %d sets, %d ways\n\n",
+         name, an->size, an->b_size, an->n_sets, an->ways);
+  printf("  %-16s %6s %-6s %-12s %-12s\n", "where", "pc", "line", "fetch", "data");
+  for (pc = 0; pc < an->size; ++pc) {
+    if (an->line[pc])
+      sprintf(src, "%d", an->line[pc]);
+    else
+      sprintf(src, "-");
+    printf("  %-16s %6d %-6s %-12s %-12s\n", where(an, pc, buf), pc, src,
+           class_names[an->fetch_class[pc]], class_names[an->data_class[pc]]);
+    fetch_counts[an->fetch_class[pc]]++;
+    data_counts[an->data_class[pc]]++;
+  }
+
+  printf("\n  %-12s", "");
+  for (k = c_unreached; k < c_none; ++k)
+    printf(" %12s", class_names[k]);
+  printf("\n  %-12s", "fetches");
+  for (k = c_unreached; k < c_none; ++k)
+    printf(" %12lld", fetch_counts[k]);
+  printf("\n  %-12s", "lw and sw");
+  for (k = c_unreached; k < c_none; ++k)
+    printf(" %12lld", data_counts[k]);
+  printf("\n");
+}
+
+/*
+ * Whether execs executions with misses misses contradict class.
+ */
+int
+contradicts(int class, long long execs, long long misses)
+{
+  switch (class) {
+    case c_unreached:
+      return execs > 0;
+    case c_always_hit:
+      return misses > 0;
+    case c_always_miss:
+      return misses != execs;
+    case c_first_miss:
+      return misses > 1;
+  }
+  return false;
+}
+
+/*
+ * Check the classification against the section of a simulator -prof
+ * report that lists every instruction executed.
+ */
+void
+checkProfile(analysisType *an, char *progName, char *profName)
+{
+  char line[MAXLINELENGTH];
+  char name[MAXLINELENGTH];
+  char src[MAXLINELENGTH];
+  char pct[MAXLINELENGTH];
+  long long execs;
+  long long instrs;
+  long long imisses;
+  long long dmisses;
+  long long checked = 0;
+  long long wrong = 0;
+  char *base;
+  int in_pcs = false;
+  int found = false;
+  FILE *profFile;
+  int pc;
+
+  profFile = fopen(profName, "r");
+  if (profFile == NULL) {
+    printf("error: can't open profile %s", profName);
+    perror("fopen");
+    exit(1);
+  }
+
+  printf("\nchecked against %s\n", profName);
+  base = strrchr(progName, '/') ? strrchr(progName, '/') + 1 : progName;
+  while (fgets(line, MAXLINELENGTH, profFile) != NULL) {
+    if (sscanf(line, "profile of %s", name) == 1) {
+      name[strlen(name) - 1] = '\0';
+      if (strcmp(name, base)) {
+        printf("error: %s is a profile of %s, not %s\n", profName, name, base);
+        exit(1);
+      }
+      continue;
+    }
+    if (!strncmp(line, "every instruction executed", 26)) {
+      in_pcs = found = true;
+      continue;
+    }
+    if (!in_pcs || sscanf(line, "%s %d %s %lld %lld %s %lld %lld", name, &pc,
+                          src, &execs, &instrs, pct, &imisses, &dmisses) != 8)
+      continue;
+    if (pc < 0 || pc >= an->size)
+      continue;
+
+    checked++;
+    if (contradicts(an->fetch_class[pc], execs, imisses)) {
+      printf("  pc %d fetch: %s, but %lld misses in %lld executions\n", pc,
+             class_names[an->fetch_class[pc]], imisses, execs);
+      wrong++;
+    }
+    if (an->data_class[pc] != c_none &&
+        contradicts(an->data_class[pc], execs, dmisses)) {
+      printf("  pc %d data: %s, but %lld misses in %lld executions\n", pc,
+             class_names[an->data_class[pc]], dmisses, execs);
+      wrong++;
+    }
+  }
+  fclose(profFile);
+
+  if (!found) {
+    printf("error: %s doesn't list every instruction, run the simulator with -prof again\n",
+           profName);
+    exit(1);
+  }
+  printf("  %lld instructions checked, %lld contradictions\n", checked, wrong);
+}
+
+void
+usage(char *prog)
+{
+  printf("error: usage: %s <machine-code file> blockSizeInWords numberOfSets blocksPerSet [options]\n", prog);
+  printf("\t-g symFile\tname pcs with the assembler's -g output\n");
+  printf("\t-check profFile\tcheck against the simulator's -prof report of a run\n\t\t\twith the same geometry\n");
+  exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *sym_name = NULL;
+  char *check_name = NULL;
+  int i;
+
+  if (argc < 5)
+    usage(argv[0]);
+
+  AN.b_size = atoi(argv[2]);
+  AN.n_sets = atoi(argv[3]);
+  AN.ways = atoi(argv[4]);
+  if (AN.b_size <= 0 || AN.n_sets <= 0 || AN.ways <= 0 || AN.ways > 60000)
+    usage(argv[0]);
+
+  for (i = 5; i < argc; ++i) {
+    if (!strcmp(argv[i], "-g") && i + 1 < argc)
+      sym_name = argv[++i];
+    else if (!strcmp(argv[i], "-check") && i + 1 < argc)
+      check_name = argv[++i];
+    else
+      usage(argv[0]);
+  }
+
+  loadProgram(&AN, argv[1]);
+  if (sym_name != NULL)
+    loadSymbols(&AN, sym_name);
+
+  initAnalysis(&AN);
+  analyse(&AN);
+  classify(&AN);
+  printAnalysis(&AN, argv[1]);
+
+  if (check_name != NULL)
+    checkProfile(&AN, argv[1], check_name);
+
+  return(0);
+}
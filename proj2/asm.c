@@ -21,11 +21,12 @@ int translateSymbol(char [MAXNUMLABELS][MAXLABELLENGTH], int labelAddress[], int
 int isNumber(char *);
 void testRegArg(char *);
 void testAddrArg(char *);
+void peephole(FILE *, FILE *, FILE *);
 
 int main(int argc, char *argv[])
 {
-    char *inFileString, *outFileString;
-    FILE *inFilePtr, *outFilePtr;
+    char *inFileString, *outFileString, *symFileString = NULL;
+    FILE *inFilePtr, *outFilePtr, *symFilePtr = NULL;
     int address;
 
     char label[MAXLINELENGTH], opcode[MAXLINELENGTH], arg0[MAXLINELENGTH], 
@@ -38,9 +39,18 @@ int main(int argc, char *argv[])
 
     char labelArray[MAXNUMLABELS][MAXLABELLENGTH];
     int labelAddress[MAXNUMLABELS];
-
-    if (argc != 3) {
-  printf("error: usage: %s <assembly-code-file> <machine-code-file>\n",
+    int optimize = 0;
+
+    for (i = 3; i < argc; i++) {
+  if (!strcmp(argv[i], "-O"))
+      optimize = 1;
+  else if (!strcmp(argv[i], "-g") && i + 1 < argc)
+      symFileString = argv[++i];
+  else
+      argc = 0;
+    }
+    if (argc < 3) {
+  printf("error: usage: %s <assembly-code-file> <machine-code-file> [-O] [-g symbol-file]\n",
       argv[0]);
   exit(1);
     }
@@ -62,6 +72,15 @@ int main(int argc, char *argv[])
   exit(1);
     }
 
+    /* the symbol table has an "address line [label]" line for every word */
+    if (symFileString != NULL) {
+  symFilePtr = fopen(symFileString, "w");
+  if (symFilePtr == NULL) {
+      printf("error in opening %s\n", symFileString);
+      exit(1);
+  }
+    }
+
     /* map symbols to addresses */
     /* assume address start at 0 */
     for (address=0; readAndParse(inFilePtr, label, opcode, arg0, arg1, arg2);
@@ -162,6 +181,11 @@ int main(int argc, char *argv[])
   addresses) */
     rewind(inFilePtr);
 
+    if (optimize) {
+  peephole(inFilePtr, outFilePtr, symFilePtr);
+  exit(0);
+    }
+
     for (address=0; readAndParse(inFilePtr, label, opcode, arg0, arg1, arg2);
       address++) {
   if (!strcmp(opcode, "add")) {
@@ -226,6 +250,9 @@ int main(int argc, char *argv[])
 
   /* printf("(address %d): %d (hex 0x%x)\n", address, num, num); */
   fprintf(outFilePtr, "%d\n", num);
+  if (symFilePtr != NULL)
+      fprintf(symFilePtr, "%d %d%s%s\n", address, address + 1,
+        label[0] ? " " : "", label);
     }
 
     exit(0);
@@ -343,3 +370,291 @@ void testAddrArg(char *arg)
   }
     }
 }
+
+/*
+ * Peephole optimizer, used with -O. The whole program is parsed into a
+ * list of lines with every symbolic field and beq offset resolved to the
+ * line it refers to, rewritten, and then encoded with addresses worked
+ * out from the lines that are left.
+ *
+ * Passes:
+ *   - beq chains are threaded through noops and unconditional beqs
+ *   - duplicate constant .fills are merged
+ *   - in straight-line code, a lw of a constant a register already holds
+ *     is dropped, one another register holds becomes an add, and loads of
+ *     0 and -1 become add/nand of register 0
+ *   - noops that nothing branches to or refers to are dropped
+ *
+ * A .fill is constant if it is labeled, only read by lw with regA 0,
+ * never has its address taken and every sw in the program stores to a
+ * label with regA 0. Deleting a line moves everything after it, so lines
+ * are only deleted if no beq offset or lw/sw address is a number that
+ * could point into the program.
+ */
+#define OPFILL 8
+#define MAXLINES MAXNUMLABELS
+
+static const char *opNames[] =
+    { "add", "nand", "lw", "sw", "beq", "cmov", "halt", "noop", ".fill" };
+
+struct asmLine {
+    char *label;
+    int op;
+    int regA;
+    int regB;
+    int destR;
+    int ref; /* line a symbolic field or beq refers to, -1 if numeric */
+    int num; /* numeric field: offset, address or .fill value */
+    int deleted;
+};
+
+int
+findLine(struct asmLine *lines, int n, char *label)
+{
+    int i;
+
+    for (i = 0; i < n; ++i)
+        if (lines[i].label != NULL && !strcmp(lines[i].label, label))
+            return i;
+
+    printf("error: missing label %s\n", label);
+    exit(1);
+}
+
+/* unconditional beq, or a noop, that control passes straight through */
+int
+passThrough(struct asmLine *l)
+{
+    return l->op == NOOP || (l->op == BEQ && l->regA == l->regB && l->ref >= 0);
+}
+
+void
+peephole(FILE *inFilePtr, FILE *outFilePtr, FILE *symFilePtr)
+{
+    char label[MAXLINELENGTH], opcode[MAXLINELENGTH], arg0[MAXLINELENGTH],
+         arg1[MAXLINELENGTH], arg2[MAXLINELENGTH];
+    struct asmLine *lines;
+    struct asmLine *l;
+    int *target;
+    int *constant;
+    int *addr;
+    int held[8]; /* held[r] is the value register r holds, if known[r] */
+    int known[8];
+    int relocatable = 1;
+    int unknownStores = 0;
+    int indexed; /* first line an indexed lw/sw could reach */
+    char *field;
+    int n = 0;
+    int i;
+    int j;
+    int r;
+    int hops;
+    int mc;
+
+    lines = malloc(sizeof(struct asmLine) * MAXLINES);
+
+    while (readAndParse(inFilePtr, label, opcode, arg0, arg1, arg2)) {
+        if (n >= MAXLINES) {
+            printf("error: too many lines\n");
+            exit(1);
+        }
+        l = &lines[n];
+        memset(l, 0, sizeof(struct asmLine));
+        l->label = label[0] ? strdup(label) : NULL;
+        for (l->op = 0; l->op <= OPFILL && strcmp(opcode, opNames[l->op]); ++l->op)
+            ;
+        if (l->op > OPFILL) {
+            printf("error: unrecognized opcode %s at address %d\n", opcode, n);
+            exit(1);
+        }
+        l->regA = atoi(arg0);
+        l->regB = atoi(arg1);
+        l->destR = atoi(arg2);
+        l->ref = -1;
+        n++;
+    }
+
+    /*
+     * resolve fields. A lw/sw with regA != 0 can reach any line from its
+     * label on, so nothing there may be merged, deleted or moved.
+     */
+    indexed = n;
+    rewind(inFilePtr);
+    for (i = 0; readAndParse(inFilePtr, label, opcode, arg0, arg1, arg2); ++i) {
+        l = &lines[i];
+        field = (l->op == OPFILL) ? arg0 : arg2;
+        if (l->op != LW && l->op != SW && l->op != BEQ && l->op != OPFILL)
+            continue;
+
+        if (!isNumber(field))
+            l->ref = findLine(lines, n, field);
+        else if (l->op == BEQ) {
+            l->num = atoi(field);
+            if (i + 1 + l->num >= 0 && i + 1 + l->num < n)
+                l->ref = i + 1 + l->num;
+            else
+                relocatable = 0;
+        }
+        else {
+            l->num = atoi(field);
+            if (l->op != OPFILL && (l->regA != 0 || (l->num >= 0 && l->num < n)))
+                relocatable = 0;
+        }
+
+        if ((l->op == LW || l->op == SW) && l->regA != 0 && l->ref >= 0 &&
+            l->ref < indexed)
+            indexed = l->ref;
+        if (l->op == SW && (l->regA != 0 || l->ref < 0))
+            unknownStores = 1;
+    }
+
+    /* thread beq chains */
+    for (i = 0; i < n; ++i) {
+        l = &lines[i];
+        if (l->op != BEQ || l->ref < 0)
+            continue;
+        for (hops = 0; hops < n && passThrough(&lines[l->ref]); ++hops) {
+            if (lines[l->ref].op == NOOP) {
+                if (l->ref + 1 >= n)
+                    break;
+                l->ref++;
+            }
+            else
+                l->ref = lines[l->ref].ref;
+        }
+    }
+
+    /* find branch targets and constant .fills */
+    target = calloc(n, sizeof(int));
+    constant = calloc(n, sizeof(int));
+    for (i = 0; i < n; ++i)
+        constant[i] = lines[i].op == OPFILL && lines[i].label != NULL &&
+                      i < indexed &&
+                      lines[i].ref < 0 && !unknownStores &&
+                      (i + 1 >= n || lines[i + 1].op != OPFILL ||
+                       lines[i + 1].label != NULL);
+    for (i = 0; i < n; ++i) {
+        l = &lines[i];
+        if (l->ref < 0)
+            continue;
+        if (l->op == BEQ)
+            target[l->ref] = 1;
+        else if (l->op != LW || l->regA != 0)
+            constant[l->ref] = 0;
+    }
+
+    /* merge duplicate constants */
+    for (i = 0; relocatable && i < n; ++i) {
+        if (!constant[i] || lines[i].deleted)
+            continue;
+        for (j = i + 1; j < n; ++j) {
+            if (constant[j] && !lines[j].deleted && lines[j].num == lines[i].num) {
+                lines[j].deleted = 1;
+                for (r = 0; r < n; ++r)
+                    if (lines[r].ref == j)
+                        lines[r].ref = i;
+            }
+        }
+    }
+
+    /* constant loads in straight-line code */
+    for (r = 0; r < 8; ++r)
+        known[r] = 0;
+    for (i = 0; i < n; ++i) {
+        l = &lines[i];
+        if (target[i])
+            for (r = 0; r < 8; ++r)
+                known[r] = 0;
+        known[0] = 1;
+        held[0] = 0;
+
+        if (l->op == LW && l->regA == 0 && l->regB != 0 && l->ref >= 0 &&
+            constant[l->ref]) {
+            int val = lines[l->ref].num;
+
+            if (known[l->regB] && held[l->regB] == val && relocatable &&
+                i < indexed) {
+                l->deleted = 1;
+                continue;
+            }
+            for (r = 0; r < 8 && !(known[r] && held[r] == val); ++r)
+                ;
+            if (r < 8) {
+                l->op = ADD;
+                l->regA = r;
+                l->destR = l->regB;
+                l->regB = 0;
+            }
+            else if (val == -1) {
+                l->op = NAND;
+                l->regA = 0;
+                l->destR = l->regB;
+                l->regB = 0;
+            }
+            else {
+                known[l->regB] = 1;
+                held[l->regB] = val;
+                continue;
+            }
+            l->ref = -1;
+            known[l->destR] = 1;
+            held[l->destR] = val;
+        }
+        else if (l->op == ADD || l->op == NAND || l->op == CMOV) {
+            if (l->op == ADD && known[l->regA] && known[l->regB]) {
+                held[l->destR] = held[l->regA] + held[l->regB];
+                known[l->destR] = 1;
+            }
+            else if (l->op == NAND && known[l->regA] && known[l->regB]) {
+                held[l->destR] = ~(held[l->regA] & held[l->regB]);
+                known[l->destR] = 1;
+            }
+            else
+                known[l->destR] = 0;
+        }
+        else if (l->op == LW)
+            known[l->regB] = 0;
+    }
+
+    /* drop noops nothing refers to */
+    for (i = 0; relocatable && i < n; ++i)
+        if (lines[i].op == NOOP && !target[i] && i < indexed)
+            lines[i].deleted = 1;
+    for (i = 0; i < n; ++i)
+        if (lines[i].ref >= 0 && lines[lines[i].ref].deleted &&
+            lines[lines[i].ref].op == NOOP)
+            lines[lines[i].ref].deleted = 0;
+
+    /* new addresses; a deleted line takes the address of the next one */
+    addr = malloc(sizeof(int) * (n + 1));
+    for (i = 0, j = 0; i < n; ++i) {
+        addr[i] = j;
+        if (!lines[i].deleted)
+            j++;
+    }
+    addr[n] = j;
+
+    for (i = 0; i < n; ++i) {
+        l = &lines[i];
+        if (l->deleted)
+            continue;
+
+        if (l->op == ADD || l->op == NAND || l->op == CMOV)
+            mc = (l->op << 22) | (l->regA << 19) | (l->regB << 16) | l->destR;
+        else if (l->op == HALT || l->op == NOOP)
+            mc = (l->op << 22);
+        else if (l->op == OPFILL)
+            mc = (l->ref >= 0) ? addr[l->ref] : l->num;
+        else {
+            if (l->op == BEQ)
+                mc = (l->ref >= 0) ? addr[l->ref] - addr[i] - 1 : l->num;
+            else
+                mc = (l->ref >= 0) ? addr[l->ref] : l->num;
+            mc = (l->op << 22) | (l->regA << 19) | (l->regB << 16) | (mc & 0xFFFF);
+        }
+        fprintf(outFilePtr, "%d\n", mc);
+        if (symFilePtr != NULL)
+            fprintf(symFilePtr, "%d %d%s%s\n", addr[i], i + 1,
+                l->label ? " " : "", l->label ? l->label : "");
+    }
+}
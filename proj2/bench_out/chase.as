@@ -0,0 +1,4107 @@
+        lw      0 1 steps
+        lw      0 6 neg1
+        lw      0 2 head
+loop    beq     0 1 done
+        lw      2 2 0
+        add     1 6 1
+        beq     0 0 loop
+done    halt
+steps   .fill   1000000
+neg1    .fill   -1
+head    .fill   n0
+n0	.fill	n1308
+n1	.fill	n2609
+n2	.fill	n1634
+n3	.fill	n3180
+n4	.fill	n687
+n5	.fill	n37
+n6	.fill	n3879
+n7	.fill	n3176
+n8	.fill	n1802
+n9	.fill	n1402
+n10	.fill	n2077
+n11	.fill	n2233
+n12	.fill	n1436
+n13	.fill	n429
+n14	.fill	n188
+n15	.fill	n1066
+n16	.fill	n1845
+n17	.fill	n1053
+n18	.fill	n2459
+n19	.fill	n113
+n20	.fill	n3880
+n21	.fill	n118
+n22	.fill	n3113
+n23	.fill	n2592
+n24	.fill	n1752
+n25	.fill	n3733
+n26	.fill	n2507
+n27	.fill	n3808
+n28	.fill	n2979
+n29	.fill	n1547
+n30	.fill	n3350
+n31	.fill	n4
+n32	.fill	n858
+n33	.fill	n3571
+n34	.fill	n3128
+n35	.fill	n4067
+n36	.fill	n2439
+n37	.fill	n2406
+n38	.fill	n198
+n39	.fill	n2602
+n40	.fill	n3068
+n41	.fill	n2039
+n42	.fill	n758
+n43	.fill	n832
+n44	.fill	n2744
+n45	.fill	n3402
+n46	.fill	n3423
+n47	.fill	n2788
+n48	.fill	n1215
+n49	.fill	n639
+n50	.fill	n1186
+n51	.fill	n4003
+n52	.fill	n432
+n53	.fill	n577
+n54	.fill	n2859
+n55	.fill	n3648
+n56	.fill	n1129
+n57	.fill	n683
+n58	.fill	n4006
+n59	.fill	n2052
+n60	.fill	n3439
+n61	.fill	n3279
+n62	.fill	n1453
+n63	.fill	n1560
+n64	.fill	n2437
+n65	.fill	n3591
+n66	.fill	n2446
+n67	.fill	n3974
+n68	.fill	n3690
+n69	.fill	n3576
+n70	.fill	n2679
+n71	.fill	n3615
+n72	.fill	n2261
+n73	.fill	n2572
+n74	.fill	n887
+n75	.fill	n2674
+n76	.fill	n2246
+n77	.fill	n1905
+n78	.fill	n2036
+n79	.fill	n3167
+n80	.fill	n3912
+n81	.fill	n2228
+n82	.fill	n2656
+n83	.fill	n2895
+n84	.fill	n1313
+n85	.fill	n2328
+n86	.fill	n3075
+n87	.fill	n3059
+n88	.fill	n3595
+n89	.fill	n3158
+n90	.fill	n2969
+n91	.fill	n417
+n92	.fill	n515
+n93	.fill	n1301
+n94	.fill	n3384
+n95	.fill	n2237
+n96	.fill	n3053
+n97	.fill	n2004
+n98	.fill	n633
+n99	.fill	n513
+n100	.fill	n644
+n101	.fill	n186
+n102	.fill	n2117
+n103	.fill	n1015
+n104	.fill	n1384
+n105	.fill	n92
+n106	.fill	n3366
+n107	.fill	n569
+n108	.fill	n3881
+n109	.fill	n2666
+n110	.fill	n1864
+n111	.fill	n628
+n112	.fill	n4087
+n113	.fill	n1029
+n114	.fill	n62
+n115	.fill	n2012
+n116	.fill	n1757
+n117	.fill	n3123
+n118	.fill	n2104
+n119	.fill	n137
+n120	.fill	n2300
+n121	.fill	n3352
+n122	.fill	n2751
+n123	.fill	n610
+n124	.fill	n802
+n125	.fill	n537
+n126	.fill	n1889
+n127	.fill	n2962
+n128	.fill	n3206
+n129	.fill	n1375
+n130	.fill	n2752
+n131	.fill	n3304
+n132	.fill	n3175
+n133	.fill	n2424
+n134	.fill	n20
+n135	.fill	n1021
+n136	.fill	n3051
+n137	.fill	n1101
+n138	.fill	n895
+n139	.fill	n358
+n140	.fill	n3551
+n141	.fill	n621
+n142	.fill	n548
+n143	.fill	n2188
+n144	.fill	n318
+n145	.fill	n3935
+n146	.fill	n2189
+n147	.fill	n2922
+n148	.fill	n466
+n149	.fill	n3636
+n150	.fill	n3993
+n151	.fill	n3421
+n152	.fill	n2245
+n153	.fill	n139
+n154	.fill	n2293
+n155	.fill	n965
+n156	.fill	n2299
+n157	.fill	n2496
+n158	.fill	n1599
+n159	.fill	n677
+n160	.fill	n224
+n161	.fill	n958
+n162	.fill	n1746
+n163	.fill	n3146
+n164	.fill	n3805
+n165	.fill	n3791
+n166	.fill	n890
+n167	.fill	n3845
+n168	.fill	n1343
+n169	.fill	n3014
+n170	.fill	n2667
+n171	.fill	n3943
+n172	.fill	n575
+n173	.fill	n321
+n174	.fill	n3981
+n175	.fill	n2728
+n176	.fill	n1513
+n177	.fill	n3520
+n178	.fill	n1374
+n179	.fill	n2486
+n180	.fill	n2144
+n181	.fill	n2224
+n182	.fill	n686
+n183	.fill	n105
+n184	.fill	n140
+n185	.fill	n1176
+n186	.fill	n334
+n187	.fill	n68
+n188	.fill	n1365
+n189	.fill	n1922
+n190	.fill	n1876
+n191	.fill	n2477
+n192	.fill	n1852
+n193	.fill	n3810
+n194	.fill	n2497
+n195	.fill	n1947
+n196	.fill	n2165
+n197	.fill	n3593
+n198	.fill	n3627
+n199	.fill	n2239
+n200	.fill	n3737
+n201	.fill	n2389
+n202	.fill	n1397
+n203	.fill	n306
+n204	.fill	n400
+n205	.fill	n2031
+n206	.fill	n2746
+n207	.fill	n4005
+n208	.fill	n396
+n209	.fill	n3052
+n210	.fill	n1489
+n211	.fill	n3972
+n212	.fill	n2152
+n213	.fill	n500
+n214	.fill	n828
+n215	.fill	n556
+n216	.fill	n455
+n217	.fill	n3264
+n218	.fill	n3003
+n219	.fill	n3196
+n220	.fill	n3597
+n221	.fill	n1501
+n222	.fill	n1701
+n223	.fill	n766
+n224	.fill	n2153
+n225	.fill	n4023
+n226	.fill	n2542
+n227	.fill	n4083
+n228	.fill	n3281
+n229	.fill	n664
+n230	.fill	n1767
+n231	.fill	n768
+n232	.fill	n3030
+n233	.fill	n1099
+n234	.fill	n205
+n235	.fill	n3187
+n236	.fill	n3587
+n237	.fill	n1972
+n238	.fill	n1131
+n239	.fill	n3274
+n240	.fill	n1320
+n241	.fill	n2270
+n242	.fill	n3941
+n243	.fill	n67
+n244	.fill	n1650
+n245	.fill	n839
+n246	.fill	n2146
+n247	.fill	n2843
+n248	.fill	n691
+n249	.fill	n3814
+n250	.fill	n3769
+n251	.fill	n1179
+n252	.fill	n2089
+n253	.fill	n501
+n254	.fill	n2995
+n255	.fill	n1644
+n256	.fill	n830
+n257	.fill	n1832
+n258	.fill	n2909
+n259	.fill	n2820
+n260	.fill	n1010
+n261	.fill	n1969
+n262	.fill	n2262
+n263	.fill	n1575
+n264	.fill	n3374
+n265	.fill	n2767
+n266	.fill	n4018
+n267	.fill	n3505
+n268	.fill	n2561
+n269	.fill	n230
+n270	.fill	n774
+n271	.fill	n2954
+n272	.fill	n3957
+n273	.fill	n2464
+n274	.fill	n2494
+n275	.fill	n3958
+n276	.fill	n2217
+n277	.fill	n3751
+n278	.fill	n2353
+n279	.fill	n1004
+n280	.fill	n1510
+n281	.fill	n1437
+n282	.fill	n1679
+n283	.fill	n2834
+n284	.fill	n36
+n285	.fill	n1237
+n286	.fill	n1818
+n287	.fill	n1908
+n288	.fill	n883
+n289	.fill	n1318
+n290	.fill	n3942
+n291	.fill	n545
+n292	.fill	n1386
+n293	.fill	n243
+n294	.fill	n3270
+n295	.fill	n2830
+n296	.fill	n255
+n297	.fill	n13
+n298	.fill	n3560
+n299	.fill	n3137
+n300	.fill	n3760
+n301	.fill	n1756
+n302	.fill	n1794
+n303	.fill	n588
+n304	.fill	n1072
+n305	.fill	n30
+n306	.fill	n2232
+n307	.fill	n2462
+n308	.fill	n3515
+n309	.fill	n2101
+n310	.fill	n1160
+n311	.fill	n3089
+n312	.fill	n3100
+n313	.fill	n245
+n314	.fill	n669
+n315	.fill	n3124
+n316	.fill	n985
+n317	.fill	n3947
+n318	.fill	n2681
+n319	.fill	n1379
+n320	.fill	n2460
+n321	.fill	n35
+n322	.fill	n3456
+n323	.fill	n2988
+n324	.fill	n1461
+n325	.fill	n3238
+n326	.fill	n368
+n327	.fill	n1722
+n328	.fill	n1452
+n329	.fill	n718
+n330	.fill	n1545
+n331	.fill	n785
+n332	.fill	n1478
+n333	.fill	n3018
+n334	.fill	n2093
+n335	.fill	n2673
+n336	.fill	n4074
+n337	.fill	n1571
+n338	.fill	n91
+n339	.fill	n1867
+n340	.fill	n3332
+n341	.fill	n309
+n342	.fill	n122
+n343	.fill	n1042
+n344	.fill	n2599
+n345	.fill	n1587
+n346	.fill	n1027
+n347	.fill	n2695
+n348	.fill	n760
+n349	.fill	n2255
+n350	.fill	n1487
+n351	.fill	n1430
+n352	.fill	n553
+n353	.fill	n1126
+n354	.fill	n1742
+n355	.fill	n5
+n356	.fill	n3139
+n357	.fill	n373
+n358	.fill	n514
+n359	.fill	n361
+n360	.fill	n1082
+n361	.fill	n2376
+n362	.fill	n2525
+n363	.fill	n2806
+n364	.fill	n795
+n365	.fill	n54
+n366	.fill	n3331
+n367	.fill	n364
+n368	.fill	n1593
+n369	.fill	n3265
+n370	.fill	n1283
+n371	.fill	n1302
+n372	.fill	n891
+n373	.fill	n2612
+n374	.fill	n2926
+n375	.fill	n3507
+n376	.fill	n3983
+n377	.fill	n1162
+n378	.fill	n885
+n379	.fill	n3050
+n380	.fill	n2530
+n381	.fill	n1248
+n382	.fill	n256
+n383	.fill	n2495
+n384	.fill	n2191
+n385	.fill	n1449
+n386	.fill	n618
+n387	.fill	n1062
+n388	.fill	n1125
+n389	.fill	n2141
+n390	.fill	n596
+n391	.fill	n21
+n392	.fill	n322
+n393	.fill	n3755
+n394	.fill	n447
+n395	.fill	n144
+n396	.fill	n3723
+n397	.fill	n3811
+n398	.fill	n3678
+n399	.fill	n3162
+n400	.fill	n3869
+n401	.fill	n831
+n402	.fill	n4039
+n403	.fill	n3129
+n404	.fill	n3604
+n405	.fill	n460
+n406	.fill	n4060
+n407	.fill	n472
+n408	.fill	n2326
+n409	.fill	n573
+n410	.fill	n1930
+n411	.fill	n3381
+n412	.fill	n4000
+n413	.fill	n2690
+n414	.fill	n3683
+n415	.fill	n2883
+n416	.fill	n546
+n417	.fill	n3491
+n418	.fill	n3651
+n419	.fill	n3716
+n420	.fill	n3750
+n421	.fill	n2336
+n422	.fill	n116
+n423	.fill	n3882
+n424	.fill	n616
+n425	.fill	n307
+n426	.fill	n2091
+n427	.fill	n2131
+n428	.fill	n2263
+n429	.fill	n414
+n430	.fill	n1455
+n431	.fill	n2983
+n432	.fill	n3743
+n433	.fill	n3501
+n434	.fill	n272
+n435	.fill	n2166
+n436	.fill	n451
+n437	.fill	n1920
+n438	.fill	n600
+n439	.fill	n3152
+n440	.fill	n2882
+n441	.fill	n3084
+n442	.fill	n3800
+n443	.fill	n3496
+n444	.fill	n960
+n445	.fill	n1098
+n446	.fill	n2208
+n447	.fill	n825
+n448	.fill	n748
+n449	.fill	n1899
+n450	.fill	n810
+n451	.fill	n2632
+n452	.fill	n1849
+n453	.fill	n3577
+n454	.fill	n3907
+n455	.fill	n1203
+n456	.fill	n1450
+n457	.fill	n185
+n458	.fill	n2196
+n459	.fill	n2968
+n460	.fill	n445
+n461	.fill	n176
+n462	.fill	n638
+n463	.fill	n3715
+n464	.fill	n121
+n465	.fill	n2358
+n466	.fill	n1271
+n467	.fill	n730
+n468	.fill	n1039
+n469	.fill	n983
+n470	.fill	n962
+n471	.fill	n3553
+n472	.fill	n2685
+n473	.fill	n645
+n474	.fill	n220
+n475	.fill	n516
+n476	.fill	n2801
+n477	.fill	n194
+n478	.fill	n1795
+n479	.fill	n1497
+n480	.fill	n3105
+n481	.fill	n694
+n482	.fill	n266
+n483	.fill	n924
+n484	.fill	n3851
+n485	.fill	n3580
+n486	.fill	n1686
+n487	.fill	n412
+n488	.fill	n3387
+n489	.fill	n1635
+n490	.fill	n3216
+n491	.fill	n2130
+n492	.fill	n3358
+n493	.fill	n1707
+n494	.fill	n208
+n495	.fill	n179
+n496	.fill	n3548
+n497	.fill	n3349
+n498	.fill	n3457
+n499	.fill	n3754
+n500	.fill	n3855
+n501	.fill	n3663
+n502	.fill	n2045
+n503	.fill	n2395
+n504	.fill	n65
+n505	.fill	n3738
+n506	.fill	n2761
+n507	.fill	n3328
+n508	.fill	n1063
+n509	.fill	n557
+n510	.fill	n273
+n511	.fill	n522
+n512	.fill	n781
+n513	.fill	n2055
+n514	.fill	n3829
+n515	.fill	n452
+n516	.fill	n3091
+n517	.fill	n3549
+n518	.fill	n2185
+n519	.fill	n1699
+n520	.fill	n1926
+n521	.fill	n2678
+n522	.fill	n1790
+n523	.fill	n1435
+n524	.fill	n2786
+n525	.fill	n1594
+n526	.fill	n982
+n527	.fill	n3106
+n528	.fill	n2877
+n529	.fill	n1975
+n530	.fill	n3557
+n531	.fill	n3514
+n532	.fill	n3070
+n533	.fill	n3309
+n534	.fill	n2352
+n535	.fill	n133
+n536	.fill	n1175
+n537	.fill	n28
+n538	.fill	n3630
+n539	.fill	n1584
+n540	.fill	n3647
+n541	.fill	n2099
+n542	.fill	n788
+n543	.fill	n2652
+n544	.fill	n1882
+n545	.fill	n1413
+n546	.fill	n1782
+n547	.fill	n152
+n548	.fill	n1056
+n549	.fill	n2399
+n550	.fill	n112
+n551	.fill	n1327
+n552	.fill	n3021
+n553	.fill	n679
+n554	.fill	n3642
+n555	.fill	n880
+n556	.fill	n1591
+n557	.fill	n560
+n558	.fill	n1971
+n559	.fill	n110
+n560	.fill	n1726
+n561	.fill	n2179
+n562	.fill	n3906
+n563	.fill	n1499
+n564	.fill	n2313
+n565	.fill	n2948
+n566	.fill	n4069
+n567	.fill	n128
+n568	.fill	n2710
+n569	.fill	n2502
+n570	.fill	n848
+n571	.fill	n3117
+n572	.fill	n2042
+n573	.fill	n3425
+n574	.fill	n2619
+n575	.fill	n3438
+n576	.fill	n1893
+n577	.fill	n281
+n578	.fill	n1105
+n579	.fill	n805
+n580	.fill	n519
+n581	.fill	n1201
+n582	.fill	n3406
+n583	.fill	n2240
+n584	.fill	n1588
+n585	.fill	n1737
+n586	.fill	n3697
+n587	.fill	n1191
+n588	.fill	n1518
+n589	.fill	n1743
+n590	.fill	n1074
+n591	.fill	n2839
+n592	.fill	n2450
+n593	.fill	n3385
+n594	.fill	n2234
+n595	.fill	n3015
+n596	.fill	n1883
+n597	.fill	n3292
+n598	.fill	n413
+n599	.fill	n502
+n600	.fill	n3148
+n601	.fill	n3841
+n602	.fill	n2256
+n603	.fill	n4041
+n604	.fill	n2107
+n605	.fill	n3489
+n606	.fill	n2725
+n607	.fill	n988
+n608	.fill	n3140
+n609	.fill	n497
+n610	.fill	n3707
+n611	.fill	n3305
+n612	.fill	n3778
+n613	.fill	n2170
+n614	.fill	n1609
+n615	.fill	n2724
+n616	.fill	n1871
+n617	.fill	n2187
+n618	.fill	n2180
+n619	.fill	n174
+n620	.fill	n1167
+n621	.fill	n1851
+n622	.fill	n3638
+n623	.fill	n75
+n624	.fill	n2639
+n625	.fill	n3465
+n626	.fill	n531
+n627	.fill	n2220
+n628	.fill	n3000
+n629	.fill	n419
+n630	.fill	n2905
+n631	.fill	n3488
+n632	.fill	n3928
+n633	.fill	n304
+n634	.fill	n886
+n635	.fill	n3736
+n636	.fill	n2528
+n637	.fill	n3312
+n638	.fill	n1574
+n639	.fill	n3839
+n640	.fill	n4052
+n641	.fill	n1712
+n642	.fill	n182
+n643	.fill	n3504
+n644	.fill	n3217
+n645	.fill	n203
+n646	.fill	n3047
+n647	.fill	n1132
+n648	.fill	n3149
+n649	.fill	n1408
+n650	.fill	n2324
+n651	.fill	n4072
+n652	.fill	n1207
+n653	.fill	n1026
+n654	.fill	n3603
+n655	.fill	n870
+n656	.fill	n2682
+n657	.fill	n3055
+n658	.fill	n2294
+n659	.fill	n4095
+n660	.fill	n3341
+n661	.fill	n3732
+n662	.fill	n729
+n663	.fill	n1094
+n664	.fill	n706
+n665	.fill	n1503
+n666	.fill	n227
+n667	.fill	n2997
+n668	.fill	n3537
+n669	.fill	n1164
+n670	.fill	n17
+n671	.fill	n1900
+n672	.fill	n126
+n673	.fill	n344
+n674	.fill	n86
+n675	.fill	n2838
+n676	.fill	n2178
+n677	.fill	n106
+n678	.fill	n3178
+n679	.fill	n2134
+n680	.fill	n3038
+n681	.fill	n2888
+n682	.fill	n2993
+n683	.fill	n4015
+n684	.fill	n2465
+n685	.fill	n786
+n686	.fill	n3313
+n687	.fill	n3080
+n688	.fill	n2427
+n689	.fill	n1500
+n690	.fill	n3462
+n691	.fill	n2192
+n692	.fill	n3519
+n693	.fill	n2013
+n694	.fill	n1069
+n695	.fill	n1880
+n696	.fill	n1732
+n697	.fill	n2229
+n698	.fill	n2021
+n699	.fill	n751
+n700	.fill	n3554
+n701	.fill	n2430
+n702	.fill	n2783
+n703	.fill	n2827
+n704	.fill	n1152
+n705	.fill	n3165
+n706	.fill	n2985
+n707	.fill	n3132
+n708	.fill	n1425
+n709	.fill	n2491
+n710	.fill	n1563
+n711	.fill	n3633
+n712	.fill	n2605
+n713	.fill	n3861
+n714	.fill	n343
+n715	.fill	n2126
+n716	.fill	n661
+n717	.fill	n1414
+n718	.fill	n1565
+n719	.fill	n1656
+n720	.fill	n2807
+n721	.fill	n2329
+n722	.fill	n3122
+n723	.fill	n3174
+n724	.fill	n918
+n725	.fill	n598
+n726	.fill	n3079
+n727	.fill	n1830
+n728	.fill	n3099
+n729	.fill	n2275
+n730	.fill	n1481
+n731	.fill	n3531
+n732	.fill	n1111
+n733	.fill	n3976
+n734	.fill	n3937
+n735	.fill	n3252
+n736	.fill	n2156
+n737	.fill	n2955
+n738	.fill	n49
+n739	.fill	n2897
+n740	.fill	n801
+n741	.fill	n403
+n742	.fill	n1249
+n743	.fill	n799
+n744	.fill	n2966
+n745	.fill	n1163
+n746	.fill	n1913
+n747	.fill	n1997
+n748	.fill	n2311
+n749	.fill	n1377
+n750	.fill	n3562
+n751	.fill	n177
+n752	.fill	n1292
+n753	.fill	n1857
+n754	.fill	n2618
+n755	.fill	n738
+n756	.fill	n2308
+n757	.fill	n1812
+n758	.fill	n921
+n759	.fill	n2687
+n760	.fill	n1630
+n761	.fill	n3301
+n762	.fill	n2824
+n763	.fill	n2745
+n764	.fill	n2452
+n765	.fill	n2184
+n766	.fill	n1315
+n767	.fill	n2050
+n768	.fill	n3612
+n769	.fill	n704
+n770	.fill	n1339
+n771	.fill	n3877
+n772	.fill	n109
+n773	.fill	n3691
+n774	.fill	n1270
+n775	.fill	n1536
+n776	.fill	n2500
+n777	.fill	n3727
+n778	.fill	n908
+n779	.fill	n2701
+n780	.fill	n1719
+n781	.fill	n2789
+n782	.fill	n3748
+n783	.fill	n1457
+n784	.fill	n3317
+n785	.fill	n1096
+n786	.fill	n712
+n787	.fill	n689
+n788	.fill	n1690
+n789	.fill	n3982
+n790	.fill	n1340
+n791	.fill	n1432
+n792	.fill	n793
+n793	.fill	n1257
+n794	.fill	n1378
+n795	.fill	n3290
+n796	.fill	n1914
+n797	.fill	n981
+n798	.fill	n1312
+n799	.fill	n1668
+n800	.fill	n3135
+n801	.fill	n2520
+n802	.fill	n1605
+n803	.fill	n1750
+n804	.fill	n3219
+n805	.fill	n2195
+n806	.fill	n1525
+n807	.fill	n11
+n808	.fill	n1976
+n809	.fill	n3895
+n810	.fill	n61
+n811	.fill	n2113
+n812	.fill	n450
+n813	.fill	n3103
+n814	.fill	n2458
+n815	.fill	n3369
+n816	.fill	n2367
+n817	.fill	n3476
+n818	.fill	n2075
+n819	.fill	n919
+n820	.fill	n3649
+n821	.fill	n1803
+n822	.fill	n2128
+n823	.fill	n326
+n824	.fill	n1409
+n825	.fill	n3830
+n826	.fill	n3164
+n827	.fill	n1337
+n828	.fill	n3807
+n829	.fill	n2448
+n830	.fill	n721
+n831	.fill	n2392
+n832	.fill	n1048
+n833	.fill	n2284
+n834	.fill	n102
+n835	.fill	n3460
+n836	.fill	n4026
+n837	.fill	n1128
+n838	.fill	n3004
+n839	.fill	n3539
+n840	.fill	n1730
+n841	.fill	n876
+n842	.fill	n2851
+n843	.fill	n662
+n844	.fill	n3569
+n845	.fill	n1998
+n846	.fill	n3302
+n847	.fill	n1135
+n848	.fill	n3987
+n849	.fill	n4030
+n850	.fill	n1002
+n851	.fill	n2554
+n852	.fill	n2181
+n853	.fill	n1863
+n854	.fill	n85
+n855	.fill	n1381
+n856	.fill	n2068
+n857	.fill	n2380
+n858	.fill	n212
+n859	.fill	n3413
+n860	.fill	n2583
+n861	.fill	n1484
+n862	.fill	n1107
+n863	.fill	n3740
+n864	.fill	n3393
+n865	.fill	n1762
+n866	.fill	n1251
+n867	.fill	n1768
+n868	.fill	n1672
+n869	.fill	n1623
+n870	.fill	n1300
+n871	.fill	n3203
+n872	.fill	n3848
+n873	.fill	n277
+n874	.fill	n2280
+n875	.fill	n762
+n876	.fill	n3214
+n877	.fill	n108
+n878	.fill	n3362
+n879	.fill	n1894
+n880	.fill	n2857
+n881	.fill	n554
+n882	.fill	n4080
+n883	.fill	n605
+n884	.fill	n1940
+n885	.fill	n2808
+n886	.fill	n1018
+n887	.fill	n530
+n888	.fill	n1558
+n889	.fill	n1844
+n890	.fill	n1158
+n891	.fill	n3316
+n892	.fill	n2473
+n893	.fill	n1405
+n894	.fill	n2250
+n895	.fill	n1426
+n896	.fill	n2513
+n897	.fill	n2025
+n898	.fill	n2889
+n899	.fill	n1344
+n900	.fill	n1403
+n901	.fill	n3446
+n902	.fill	n437
+n903	.fill	n536
+n904	.fill	n3657
+n905	.fill	n1490
+n906	.fill	n3708
+n907	.fill	n3998
+n908	.fill	n3096
+n909	.fill	n1979
+n910	.fill	n3668
+n911	.fill	n1323
+n912	.fill	n1666
+n913	.fill	n494
+n914	.fill	n2803
+n915	.fill	n2522
+n916	.fill	n3842
+n917	.fill	n1061
+n918	.fill	n496
+n919	.fill	n697
+n920	.fill	n3782
+n921	.fill	n3699
+n922	.fill	n2831
+n923	.fill	n1535
+n924	.fill	n1696
+n925	.fill	n1995
+n926	.fill	n3430
+n927	.fill	n3518
+n928	.fill	n1299
+n929	.fill	n1076
+n930	.fill	n3495
+n931	.fill	n1937
+n932	.fill	n262
+n933	.fill	n3012
+n934	.fill	n1275
+n935	.fill	n2549
+n936	.fill	n957
+n937	.fill	n2026
+n938	.fill	n815
+n939	.fill	n2870
+n940	.fill	n2109
+n941	.fill	n2295
+n942	.fill	n4038
+n943	.fill	n866
+n944	.fill	n978
+n945	.fill	n267
+n946	.fill	n407
+n947	.fill	n1648
+n948	.fill	n2488
+n949	.fill	n2590
+n950	.fill	n1713
+n951	.fill	n3910
+n952	.fill	n237
+n953	.fill	n1912
+n954	.fill	n1055
+n955	.fill	n1393
+n956	.fill	n863
+n957	.fill	n72
+n958	.fill	n3498
+n959	.fill	n2960
+n960	.fill	n3323
+n961	.fill	n620
+n962	.fill	n3620
+n963	.fill	n2976
+n964	.fill	n3524
+n965	.fill	n2594
+n966	.fill	n2823
+n967	.fill	n127
+n968	.fill	n3510
+n969	.fill	n1869
+n970	.fill	n663
+n971	.fill	n2102
+n972	.fill	n1548
+n973	.fill	n1576
+n974	.fill	n2754
+n975	.fill	n2891
+n976	.fill	n1025
+n977	.fill	n2143
+n978	.fill	n872
+n979	.fill	n2265
+n980	.fill	n426
+n981	.fill	n184
+n982	.fill	n1727
+n983	.fill	n151
+n984	.fill	n2932
+n985	.fill	n382
+n986	.fill	n742
+n987	.fill	n1944
+n988	.fill	n3288
+n989	.fill	n2944
+n990	.fill	n2415
+n991	.fill	n3093
+n992	.fill	n585
+n993	.fill	n1877
+n994	.fill	n2129
+n995	.fill	n3386
+n996	.fill	n2475
+n997	.fill	n3892
+n998	.fill	n3197
+n999	.fill	n3864
+n1000	.fill	n736
+n1001	.fill	n2343
+n1002	.fill	n2155
+n1003	.fill	n477
+n1004	.fill	n3570
+n1005	.fill	n1704
+n1006	.fill	n3086
+n1007	.fill	n25
+n1008	.fill	n1837
+n1009	.fill	n1496
+n1010	.fill	n3019
+n1011	.fill	n3347
+n1012	.fill	n1904
+n1013	.fill	n2365
+n1014	.fill	n2083
+n1015	.fill	n3641
+n1016	.fill	n1780
+n1017	.fill	n2251
+n1018	.fill	n1541
+n1019	.fill	n1508
+n1020	.fill	n507
+n1021	.fill	n41
+n1022	.fill	n2432
+n1023	.fill	n1448
+n1024	.fill	n2142
+n1025	.fill	n1243
+n1026	.fill	n3069
+n1027	.fill	n2019
+n1028	.fill	n3459
+n1029	.fill	n480
+n1030	.fill	n1994
+n1031	.fill	n2906
+n1032	.fill	n3876
+n1033	.fill	n1224
+n1034	.fill	n411
+n1035	.fill	n2917
+n1036	.fill	n3566
+n1037	.fill	n2626
+n1038	.fill	n3333
+n1039	.fill	n1983
+n1040	.fill	n558
+n1041	.fill	n970
+n1042	.fill	n1012
+n1043	.fill	n1928
+n1044	.fill	n3114
+n1045	.fill	n1238
+n1046	.fill	n1601
+n1047	.fill	n871
+n1048	.fill	n3936
+n1049	.fill	n2288
+n1050	.fill	n2471
+n1051	.fill	n3859
+n1052	.fill	n2951
+n1053	.fill	n3375
+n1054	.fill	n1182
+n1055	.fill	n308
+n1056	.fill	n3259
+n1057	.fill	n2323
+n1058	.fill	n2982
+n1059	.fill	n3083
+n1060	.fill	n3363
+n1061	.fill	n1001
+n1062	.fill	n253
+n1063	.fill	n3107
+n1064	.fill	n2603
+n1065	.fill	n2447
+n1066	.fill	n936
+n1067	.fill	n3077
+n1068	.fill	n1336
+n1069	.fill	n3684
+n1070	.fill	n3468
+n1071	.fill	n2898
+n1072	.fill	n808
+n1073	.fill	n986
+n1074	.fill	n2535
+n1075	.fill	n3702
+n1076	.fill	n1253
+n1077	.fill	n2912
+n1078	.fill	n3753
+n1079	.fill	n533
+n1080	.fill	n619
+n1081	.fill	n1582
+n1082	.fill	n240
+n1083	.fill	n2506
+n1084	.fill	n1438
+n1085	.fill	n1589
+n1086	.fill	n819
+n1087	.fill	n2340
+n1088	.fill	n2661
+n1089	.fill	n685
+n1090	.fill	n3964
+n1091	.fill	n2003
+n1092	.fill	n3088
+n1093	.fill	n2309
+n1094	.fill	n1493
+n1095	.fill	n348
+n1096	.fill	n3831
+n1097	.fill	n1067
+n1098	.fill	n2273
+n1099	.fill	n2106
+n1100	.fill	n1875
+n1101	.fill	n1071
+n1102	.fill	n1793
+n1103	.fill	n310
+n1104	.fill	n1193
+n1105	.fill	n2770
+n1106	.fill	n719
+n1107	.fill	n2750
+n1108	.fill	n1951
+n1109	.fill	n1725
+n1110	.fill	n2177
+n1111	.fill	n2711
+n1112	.fill	n797
+n1113	.fill	n1364
+n1114	.fill	n2683
+n1115	.fill	n3984
+n1116	.fill	n728
+n1117	.fill	n2047
+n1118	.fill	n57
+n1119	.fill	n3522
+n1120	.fill	n1664
+n1121	.fill	n3884
+n1122	.fill	n1355
+n1123	.fill	n293
+n1124	.fill	n3650
+n1125	.fill	n1197
+n1126	.fill	n1117
+n1127	.fill	n2718
+n1128	.fill	n1170
+n1129	.fill	n2719
+n1130	.fill	n2282
+n1131	.fill	n3437
+n1132	.fill	n534
+n1133	.fill	n2829
+n1134	.fill	n1463
+n1135	.fill	n2837
+n1136	.fill	n3126
+n1137	.fill	n3453
+n1138	.fill	n6
+n1139	.fill	n2787
+n1140	.fill	n1278
+n1141	.fill	n1755
+n1142	.fill	n90
+n1143	.fill	n3862
+n1144	.fill	n2157
+n1145	.fill	n311
+n1146	.fill	n461
+n1147	.fill	n583
+n1148	.fill	n3611
+n1149	.fill	n874
+n1150	.fill	n954
+n1151	.fill	n973
+n1152	.fill	n3081
+n1153	.fill	n731
+n1154	.fill	n3273
+n1155	.fill	n2832
+n1156	.fill	n2505
+n1157	.fill	n3795
+n1158	.fill	n313
+n1159	.fill	n761
+n1160	.fill	n1504
+n1161	.fill	n934
+n1162	.fill	n755
+n1163	.fill	n1946
+n1164	.fill	n285
+n1165	.fill	n3559
+n1166	.fill	n2533
+n1167	.fill	n3153
+n1168	.fill	n1671
+n1169	.fill	n2893
+n1170	.fill	n2812
+n1171	.fill	n1258
+n1172	.fill	n3364
+n1173	.fill	n2840
+n1174	.fill	n1735
+n1175	.fill	n963
+n1176	.fill	n4035
+n1177	.fill	n2412
+n1178	.fill	n201
+n1179	.fill	n3001
+n1180	.fill	n2214
+n1181	.fill	n2833
+n1182	.fill	n1220
+n1183	.fill	n1181
+n1184	.fill	n2183
+n1185	.fill	n2218
+n1186	.fill	n2560
+n1187	.fill	n1577
+n1188	.fill	n2700
+n1189	.fill	n1786
+n1190	.fill	n2998
+n1191	.fill	n520
+n1192	.fill	n3867
+n1193	.fill	n746
+n1194	.fill	n3706
+n1195	.fill	n2158
+n1196	.fill	n2957
+n1197	.fill	n2538
+n1198	.fill	n2073
+n1199	.fill	n1245
+n1200	.fill	n3228
+n1201	.fill	n2241
+n1202	.fill	n3357
+n1203	.fill	n2418
+n1204	.fill	n2014
+n1205	.fill	n767
+n1206	.fill	n2876
+n1207	.fill	n399
+n1208	.fill	n3031
+n1209	.fill	n278
+n1210	.fill	n3950
+n1211	.fill	n4031
+n1212	.fill	n4001
+n1213	.fill	n1068
+n1214	.fill	n3011
+n1215	.fill	n2715
+n1216	.fill	n1829
+n1217	.fill	n34
+n1218	.fill	n2125
+n1219	.fill	n3110
+n1220	.fill	n1139
+n1221	.fill	n1797
+n1222	.fill	n1429
+n1223	.fill	n1546
+n1224	.fill	n2964
+n1225	.fill	n402
+n1226	.fill	n673
+n1227	.fill	n3589
+n1228	.fill	n949
+n1229	.fill	n3667
+n1230	.fill	n2136
+n1231	.fill	n1356
+n1232	.fill	n1239
+n1233	.fill	n3521
+n1234	.fill	n3897
+n1235	.fill	n3322
+n1236	.fill	n3801
+n1237	.fill	n2472
+n1238	.fill	n1620
+n1239	.fill	n792
+n1240	.fill	n1104
+n1241	.fill	n3572
+n1242	.fill	n3469
+n1243	.fill	n1014
+n1244	.fill	n1410
+n1245	.fill	n1655
+n1246	.fill	n1049
+n1247	.fill	n3195
+n1248	.fill	n680
+n1249	.fill	n2858
+n1250	.fill	n944
+n1251	.fill	n3856
+n1252	.fill	n906
+n1253	.fill	n2173
+n1254	.fill	n601
+n1255	.fill	n100
+n1256	.fill	n3534
+n1257	.fill	n1823
+n1258	.fill	n2436
+n1259	.fill	n337
+n1260	.fill	n2937
+n1261	.fill	n2498
+n1262	.fill	n2597
+n1263	.fill	n1828
+n1264	.fill	n3980
+n1265	.fill	n1360
+n1266	.fill	n335
+n1267	.fill	n1442
+n1268	.fill	n1943
+n1269	.fill	n1754
+n1270	.fill	n2919
+n1271	.fill	n1890
+n1272	.fill	n78
+n1273	.fill	n1683
+n1274	.fill	n1087
+n1275	.fill	n646
+n1276	.fill	n2132
+n1277	.fill	n1691
+n1278	.fill	n3335
+n1279	.fill	n1815
+n1280	.fill	n2785
+n1281	.fill	n3250
+n1282	.fill	n3893
+n1283	.fill	n2546
+n1284	.fill	n3285
+n1285	.fill	n2576
+n1286	.fill	n2398
+n1287	.fill	n690
+n1288	.fill	n329
+n1289	.fill	n1019
+n1290	.fill	n282
+n1291	.fill	n2443
+n1292	.fill	n111
+n1293	.fill	n2230
+n1294	.fill	n737
+n1295	.fill	n2894
+n1296	.fill	n2945
+n1297	.fill	n1554
+n1298	.fill	n1559
+n1299	.fill	n2825
+n1300	.fill	n757
+n1301	.fill	n1931
+n1302	.fill	n1231
+n1303	.fill	n3359
+n1304	.fill	n3156
+n1305	.fill	n1000
+n1306	.fill	n604
+n1307	.fill	n3112
+n1308	.fill	n720
+n1309	.fill	n1361
+n1310	.fill	n4091
+n1311	.fill	n873
+n1312	.fill	n434
+n1313	.fill	n2391
+n1314	.fill	n2072
+n1315	.fill	n3710
+n1316	.fill	n966
+n1317	.fill	n2758
+n1318	.fill	n4065
+n1319	.fill	n423
+n1320	.fill	n1808
+n1321	.fill	n3480
+n1322	.fill	n1140
+n1323	.fill	n3253
+n1324	.fill	n1751
+n1325	.fill	n22
+n1326	.fill	n2244
+n1327	.fill	n168
+n1328	.fill	n2386
+n1329	.fill	n1465
+n1330	.fill	n3601
+n1331	.fill	n3924
+n1332	.fill	n2057
+n1333	.fill	n3494
+n1334	.fill	n510
+n1335	.fill	n3783
+n1336	.fill	n3567
+n1337	.fill	n3173
+n1338	.fill	n749
+n1339	.fill	n1885
+n1340	.fill	n2404
+n1341	.fill	n3658
+n1342	.fill	n3873
+n1343	.fill	n1127
+n1344	.fill	n3989
+n1345	.fill	n2035
+n1346	.fill	n750
+n1347	.fill	n1646
+n1348	.fill	n1151
+n1349	.fill	n2206
+n1350	.fill	n280
+n1351	.fill	n1329
+n1352	.fill	n3166
+n1353	.fill	n1028
+n1354	.fill	n1265
+n1355	.fill	n210
+n1356	.fill	n3951
+n1357	.fill	n2000
+n1358	.fill	n2641
+n1359	.fill	n2514
+n1360	.fill	n1149
+n1361	.fill	n1804
+n1362	.fill	n3477
+n1363	.fill	n1988
+n1364	.fill	n2349
+n1365	.fill	n3915
+n1366	.fill	n2138
+n1367	.fill	n3826
+n1368	.fill	n3681
+n1369	.fill	n479
+n1370	.fill	n2975
+n1371	.fill	n166
+n1372	.fill	n2198
+n1373	.fill	n4025
+n1374	.fill	n3516
+n1375	.fill	n3575
+n1376	.fill	n1933
+n1377	.fill	n1316
+n1378	.fill	n489
+n1379	.fill	n1346
+n1380	.fill	n3822
+n1381	.fill	n2608
+n1382	.fill	n159
+n1383	.fill	n4011
+n1384	.fill	n589
+n1385	.fill	n3485
+n1386	.fill	n3475
+n1387	.fill	n975
+n1388	.fill	n1492
+n1389	.fill	n2049
+n1390	.fill	n1874
+n1391	.fill	n18
+n1392	.fill	n254
+n1393	.fill	n123
+n1394	.fill	n951
+n1395	.fill	n626
+n1396	.fill	n3956
+n1397	.fill	n2463
+n1398	.fill	n3009
+n1399	.fill	n40
+n1400	.fill	n1826
+n1401	.fill	n836
+n1402	.fill	n3479
+n1403	.fill	n2082
+n1404	.fill	n2570
+n1405	.fill	n2588
+n1406	.fill	n138
+n1407	.fill	n2451
+n1408	.fill	n567
+n1409	.fill	n3695
+n1410	.fill	n124
+n1411	.fill	n1934
+n1412	.fill	n3181
+n1413	.fill	n1957
+n1414	.fill	n1169
+n1415	.fill	n2717
+n1416	.fill	n132
+n1417	.fill	n1542
+n1418	.fill	n1142
+n1419	.fill	n1309
+n1420	.fill	n1600
+n1421	.fill	n930
+n1422	.fill	n2139
+n1423	.fill	n3592
+n1424	.fill	n12
+n1425	.fill	n3032
+n1426	.fill	n4042
+n1427	.fill	n1362
+n1428	.fill	n2289
+n1429	.fill	n4048
+n1430	.fill	n2339
+n1431	.fill	n976
+n1432	.fill	n1992
+n1433	.fill	n994
+n1434	.fill	n3065
+n1435	.fill	n3024
+n1436	.fill	n1657
+n1437	.fill	n3914
+n1438	.fill	n104
+n1439	.fill	n2060
+n1440	.fill	n1665
+n1441	.fill	n158
+n1442	.fill	n366
+n1443	.fill	n1543
+n1444	.fill	n1718
+n1445	.fill	n1939
+n1446	.fill	n2668
+n1447	.fill	n3709
+n1448	.fill	n3995
+n1449	.fill	n3685
+n1450	.fill	n2383
+n1451	.fill	n29
+n1452	.fill	n4022
+n1453	.fill	n250
+n1454	.fill	n221
+n1455	.fill	n2660
+n1456	.fill	n3616
+n1457	.fill	n3916
+n1458	.fill	n383
+n1459	.fill	n590
+n1460	.fill	n1421
+n1461	.fill	n1717
+n1462	.fill	n2457
+n1463	.fill	n3558
+n1464	.fill	n325
+n1465	.fill	n1625
+n1466	.fill	n314
+n1467	.fill	n2804
+n1468	.fill	n3644
+n1469	.fill	n249
+n1470	.fill	n913
+n1471	.fill	n1477
+n1472	.fill	n3628
+n1473	.fill	n3785
+n1474	.fill	n3072
+n1475	.fill	n3613
+n1476	.fill	n1868
+n1477	.fill	n298
+n1478	.fill	n1307
+n1479	.fill	n3931
+n1480	.fill	n3141
+n1481	.fill	n529
+n1482	.fill	n46
+n1483	.fill	n2675
+n1484	.fill	n228
+n1485	.fill	n1642
+n1486	.fill	n462
+n1487	.fill	n525
+n1488	.fill	n1024
+n1489	.fill	n741
+n1490	.fill	n4075
+n1491	.fill	n2330
+n1492	.fill	n1618
+n1493	.fill	n42
+n1494	.fill	n1792
+n1495	.fill	n937
+n1496	.fill	n3728
+n1497	.fill	n1412
+n1498	.fill	n331
+n1499	.fill	n3968
+n1500	.fill	n3533
+n1501	.fill	n2266
+n1502	.fill	n511
+n1503	.fill	n2034
+n1504	.fill	n1831
+n1505	.fill	n1075
+n1506	.fill	n1901
+n1507	.fill	n2355
+n1508	.fill	n1011
+n1509	.fill	n1521
+n1510	.fill	n2571
+n1511	.fill	n2100
+n1512	.fill	n1485
+n1513	.fill	n3836
+n1514	.fill	n3473
+n1515	.fill	n1060
+n1516	.fill	n1651
+n1517	.fill	n1661
+n1518	.fill	n606
+n1519	.fill	n656
+n1520	.fill	n2707
+n1521	.fill	n388
+n1522	.fill	n2481
+n1523	.fill	n1557
+n1524	.fill	n2615
+n1525	.fill	n2161
+n1526	.fill	n3726
+n1527	.fill	n125
+n1528	.fill	n2686
+n1529	.fill	n470
+n1530	.fill	n2790
+n1531	.fill	n1925
+n1532	.fill	n193
+n1533	.fill	n1317
+n1534	.fill	n465
+n1535	.fill	n2729
+n1536	.fill	n932
+n1537	.fill	n56
+n1538	.fill	n1480
+n1539	.fill	n2509
+n1540	.fill	n1441
+n1541	.fill	n487
+n1542	.fill	n1986
+n1543	.fill	n1569
+n1544	.fill	n1781
+n1545	.fill	n759
+n1546	.fill	n1079
+n1547	.fill	n820
+n1548	.fill	n1469
+n1549	.fill	n2445
+n1550	.fill	n859
+n1551	.fill	n2238
+n1552	.fill	n2279
+n1553	.fill	n1310
+n1554	.fill	n2043
+n1555	.fill	n3463
+n1556	.fill	n2844
+n1557	.fill	n2558
+n1558	.fill	n238
+n1559	.fill	n3108
+n1560	.fill	n1626
+n1561	.fill	n2747
+n1562	.fill	n215
+n1563	.fill	n3007
+n1564	.fill	n3420
+n1565	.fill	n2516
+n1566	.fill	n892
+n1567	.fill	n3932
+n1568	.fill	n3913
+n1569	.fill	n1985
+n1570	.fill	n1433
+n1571	.fill	n1277
+n1572	.fill	n2920
+n1573	.fill	n1495
+n1574	.fill	n274
+n1575	.fill	n2112
+n1576	.fill	n933
+n1577	.fill	n3523
+n1578	.fill	n1703
+n1579	.fill	n2431
+n1580	.fill	n449
+n1581	.fill	n3458
+n1582	.fill	n1566
+n1583	.fill	n3066
+n1584	.fill	n929
+n1585	.fill	n2489
+n1586	.fill	n1662
+n1587	.fill	n93
+n1588	.fill	n99
+n1589	.fill	n1516
+n1590	.fill	n3484
+n1591	.fill	n2550
+n1592	.fill	n1306
+n1593	.fill	n716
+n1594	.fill	n2743
+n1595	.fill	n492
+n1596	.fill	n1269
+n1597	.fill	n1950
+n1598	.fill	n3142
+n1599	.fill	n1347
+n1600	.fill	n3429
+n1601	.fill	n226
+n1602	.fill	n2172
+n1603	.fill	n45
+n1604	.fill	n3138
+n1605	.fill	n3048
+n1606	.fill	n2809
+n1607	.fill	n3256
+n1608	.fill	n2030
+n1609	.fill	n58
+n1610	.fill	n3689
+n1611	.fill	n1213
+n1612	.fill	n2512
+n1613	.fill	n867
+n1614	.fill	n378
+n1615	.fill	n3151
+n1616	.fill	n1763
+n1617	.fill	n3200
+n1618	.fill	n3676
+n1619	.fill	n3109
+n1620	.fill	n2738
+n1621	.fill	n1188
+n1622	.fill	n2103
+n1623	.fill	n1766
+n1624	.fill	n3568
+n1625	.fill	n711
+n1626	.fill	n1266
+n1627	.fill	n4053
+n1628	.fill	n3008
+n1629	.fill	n2470
+n1630	.fill	n2684
+n1631	.fill	n950
+n1632	.fill	n3780
+n1633	.fill	n3530
+n1634	.fill	n935
+n1635	.fill	n2676
+n1636	.fill	n2301
+n1637	.fill	n2408
+n1638	.fill	n1873
+n1639	.fill	n2694
+n1640	.fill	n2556
+n1641	.fill	n161
+n1642	.fill	n1211
+n1643	.fill	n1689
+n1644	.fill	n3525
+n1645	.fill	n3973
+n1646	.fill	n840
+n1647	.fill	n3355
+n1648	.fill	n2653
+n1649	.fill	n1282
+n1650	.fill	n2319
+n1651	.fill	n2826
+n1652	.fill	n849
+n1653	.fill	n1836
+n1654	.fill	n2815
+n1655	.fill	n2277
+n1656	.fill	n3824
+n1657	.fill	n1474
+n1658	.fill	n4064
+n1659	.fill	n827
+n1660	.fill	n4033
+n1661	.fill	n3653
+n1662	.fill	n316
+n1663	.fill	n424
+n1664	.fill	n838
+n1665	.fill	n1359
+n1666	.fill	n1124
+n1667	.fill	n475
+n1668	.fill	n1263
+n1669	.fill	n2735
+n1670	.fill	n1733
+n1671	.fill	n2771
+n1672	.fill	n2990
+n1673	.fill	n103
+n1674	.fill	n3482
+n1675	.fill	n835
+n1676	.fill	n1738
+n1677	.fill	n1383
+n1678	.fill	n2961
+n1679	.fill	n2896
+n1680	.fill	n3659
+n1681	.fill	n1341
+n1682	.fill	n1498
+n1683	.fill	n1772
+n1684	.fill	n2028
+n1685	.fill	n1392
+n1686	.fill	n3992
+n1687	.fill	n1155
+n1688	.fill	n2020
+n1689	.fill	n130
+n1690	.fill	n1184
+n1691	.fill	n4024
+n1692	.fill	n3242
+n1693	.fill	n1606
+n1694	.fill	n655
+n1695	.fill	n3875
+n1696	.fill	n1290
+n1697	.fill	n3497
+n1698	.fill	n1051
+n1699	.fill	n2585
+n1700	.fill	n3294
+n1701	.fill	n2388
+n1702	.fill	n1978
+n1703	.fill	n1540
+n1704	.fill	n270
+n1705	.fill	n485
+n1706	.fill	n1530
+n1707	.fill	n88
+n1708	.fill	n1121
+n1709	.fill	n2577
+n1710	.fill	n927
+n1711	.fill	n1507
+n1712	.fill	n3902
+n1713	.fill	n1148
+n1714	.fill	n2362
+n1715	.fill	n3060
+n1716	.fill	n200
+n1717	.fill	n1147
+n1718	.fill	n2310
+n1719	.fill	n2379
+n1720	.fill	n658
+n1721	.fill	n3637
+n1722	.fill	n2578
+n1723	.fill	n999
+n1724	.fill	n406
+n1725	.fill	n3401
+n1726	.fill	n2545
+n1727	.fill	n3085
+n1728	.fill	n3909
+n1729	.fill	n2574
+n1730	.fill	n657
+n1731	.fill	n3337
+n1732	.fill	n363
+n1733	.fill	n3226
+n1734	.fill	n3241
+n1735	.fill	n3023
+n1736	.fill	n2774
+n1737	.fill	n1206
+n1738	.fill	n1728
+n1739	.fill	n3125
+n1740	.fill	n2913
+n1741	.fill	n1884
+n1742	.fill	n3293
+n1743	.fill	n3119
+n1744	.fill	n3263
+n1745	.fill	n305
+n1746	.fill	n1675
+n1747	.fill	n1398
+n1748	.fill	n1799
+n1749	.fill	n1091
+n1750	.fill	n1568
+n1751	.fill	n3276
+n1752	.fill	n64
+n1753	.fill	n2204
+n1754	.fill	n4047
+n1755	.fill	n1367
+n1756	.fill	n2780
+n1757	.fill	n2628
+n1758	.fill	n3625
+n1759	.fill	n2235
+n1760	.fill	n2741
+n1761	.fill	n38
+n1762	.fill	n3509
+n1763	.fill	n408
+n1764	.fill	n3043
+n1765	.fill	n3391
+n1766	.fill	n967
+n1767	.fill	n1168
+n1768	.fill	n3049
+n1769	.fill	n879
+n1770	.fill	n1040
+n1771	.fill	n1229
+n1772	.fill	n1515
+n1773	.fill	n3827
+n1774	.fill	n1783
+n1775	.fill	n418
+n1776	.fill	n387
+n1777	.fill	n1036
+n1778	.fill	n1529
+n1779	.fill	n783
+n1780	.fill	n4058
+n1781	.fill	n2564
+n1782	.fill	n1859
+n1783	.fill	n3986
+n1784	.fill	n2720
+n1785	.fill	n3308
+n1786	.fill	n1760
+n1787	.fill	n3586
+n1788	.fill	n699
+n1789	.fill	n1064
+n1790	.fill	n3026
+n1791	.fill	n3762
+n1792	.fill	n1502
+n1793	.fill	n2915
+n1794	.fill	n3823
+n1795	.fill	n1551
+n1796	.fill	n1065
+n1797	.fill	n3037
+n1798	.fill	n76
+n1799	.fill	n3094
+n1800	.fill	n486
+n1801	.fill	n2586
+n1802	.fill	n2689
+n1803	.fill	n2387
+n1804	.fill	n2267
+n1805	.fill	n236
+n1806	.fill	n3237
+n1807	.fill	n1528
+n1808	.fill	n1174
+n1809	.fill	n1321
+n1810	.fill	n813
+n1811	.fill	n2182
+n1812	.fill	n1342
+n1813	.fill	n2307
+n1814	.fill	n3834
+n1815	.fill	n3380
+n1816	.fill	n4056
+n1817	.fill	n319
+n1818	.fill	n2892
+n1819	.fill	n572
+n1820	.fill	n821
+n1821	.fill	n993
+n1822	.fill	n1090
+n1823	.fill	n1878
+n1824	.fill	n189
+n1825	.fill	n878
+n1826	.fill	n1716
+n1827	.fill	n3626
+n1828	.fill	n3815
+n1829	.fill	n1391
+n1830	.fill	n2849
+n1831	.fill	n3251
+n1832	.fill	n3419
+n1833	.fill	n526
+n1834	.fill	n3828
+n1835	.fill	n3871
+n1836	.fill	n3940
+n1837	.fill	n1603
+n1838	.fill	n2756
+n1839	.fill	n3635
+n1840	.fill	n457
+n1841	.fill	n2011
+n1842	.fill	n3971
+n1843	.fill	n1533
+n1844	.fill	n3872
+n1845	.fill	n1996
+n1846	.fill	n1228
+n1847	.fill	n696
+n1848	.fill	n3903
+n1849	.fill	n1161
+n1850	.fill	n216
+n1851	.fill	n2647
+n1852	.fill	n1178
+n1853	.fill	n3789
+n1854	.fill	n1077
+n1855	.fill	n2332
+n1856	.fill	n1208
+n1857	.fill	n2757
+n1858	.fill	n947
+n1859	.fill	n214
+n1860	.fill	n2046
+n1861	.fill	n3654
+n1862	.fill	n2740
+n1863	.fill	n2925
+n1864	.fill	n667
+n1865	.fill	n2855
+n1866	.fill	n2223
+n1867	.fill	n705
+n1868	.fill	n3194
+n1869	.fill	n527
+n1870	.fill	n3798
+n1871	.fill	n1214
+n1872	.fill	n2335
+n1873	.fill	n3714
+n1874	.fill	n3213
+n1875	.fill	n3934
+n1876	.fill	n1891
+n1877	.fill	n2393
+n1878	.fill	n2722
+n1879	.fill	n339
+n1880	.fill	n1538
+n1881	.fill	n2863
+n1882	.fill	n3171
+n1883	.fill	n2627
+n1884	.fill	n3985
+n1885	.fill	n3407
+n1886	.fill	n2828
+n1887	.fill	n1888
+n1888	.fill	n3367
+n1889	.fill	n2038
+n1890	.fill	n3955
+n1891	.fill	n3160
+n1892	.fill	n971
+n1893	.fill	n257
+n1894	.fill	n2958
+n1895	.fill	n2604
+n1896	.fill	n286
+n1897	.fill	n747
+n1898	.fill	n181
+n1899	.fill	n3487
+n1900	.fill	n2963
+n1901	.fill	n837
+n1902	.fill	n3348
+n1903	.fill	n3863
+n1904	.fill	n1870
+n1905	.fill	n2350
+n1906	.fill	n901
+n1907	.fill	n3205
+n1908	.fill	n2651
+n1909	.fill	n538
+n1910	.fill	n219
+n1911	.fill	n2940
+n1912	.fill	n670
+n1913	.fill	n2665
+n1914	.fill	n3291
+n1915	.fill	n2552
+n1916	.fill	n3770
+n1917	.fill	n3645
+n1918	.fill	n3901
+n1919	.fill	n3062
+n1920	.fill	n365
+n1921	.fill	n16
+n1922	.fill	n2762
+n1923	.fill	n1456
+n1924	.fill	n1945
+n1925	.fill	n2236
+n1926	.fill	n3168
+n1927	.fill	n1759
+n1928	.fill	n3739
+n1929	.fill	n3111
+n1930	.fill	n392
+n1931	.fill	n1916
+n1932	.fill	n95
+n1933	.fill	n231
+n1934	.fill	n3307
+n1935	.fill	n1108
+n1936	.fill	n3670
+n1937	.fill	n1918
+n1938	.fill	n1602
+n1939	.fill	n4002
+n1940	.fill	n1604
+n1941	.fill	n2097
+n1942	.fill	n2066
+n1943	.fill	n532
+n1944	.fill	n2499
+n1945	.fill	n4043
+n1946	.fill	n2798
+n1947	.fill	n1234
+n1948	.fill	n723
+n1949	.fill	n824
+n1950	.fill	n2709
+n1951	.fill	n53
+n1952	.fill	n410
+n1953	.fill	n2836
+n1954	.fill	n3850
+n1955	.fill	n899
+n1956	.fill	n3835
+n1957	.fill	n777
+n1958	.fill	n2242
+n1959	.fill	n2974
+n1960	.fill	n2420
+n1961	.fill	n2174
+n1962	.fill	n3742
+n1963	.fill	n1952
+n1964	.fill	n1693
+n1965	.fill	n1050
+n1966	.fill	n1608
+n1967	.fill	n439
+n1968	.fill	n3415
+n1969	.fill	n2366
+n1970	.fill	n3471
+n1971	.fill	n2147
+n1972	.fill	n2040
+n1973	.fill	n2613
+n1974	.fill	n1938
+n1975	.fill	n3202
+n1976	.fill	n3777
+n1977	.fill	n3731
+n1978	.fill	n1896
+n1979	.fill	n2792
+n1980	.fill	n2726
+n1981	.fill	n860
+n1982	.fill	n3145
+n1983	.fill	n3729
+n1984	.fill	n1122
+n1985	.fill	n945
+n1986	.fill	n453
+n1987	.fill	n928
+n1988	.fill	n923
+n1989	.fill	n435
+n1990	.fill	n1157
+n1991	.fill	n846
+n1992	.fill	n2706
+n1993	.fill	n3154
+n1994	.fill	n1373
+n1995	.fill	n1037
+n1996	.fill	n3157
+n1997	.fill	n904
+n1998	.fill	n1860
+n1999	.fill	n2276
+n2000	.fill	n1674
+n2001	.fill	n2880
+n2002	.fill	n2972
+n2003	.fill	n3318
+n2004	.fill	n2274
+n2005	.fill	n3478
+n2006	.fill	n2904
+n2007	.fill	n3189
+n2008	.fill	n1120
+n2009	.fill	n902
+n2010	.fill	n3010
+n2011	.fill	n1006
+n2012	.fill	n1078
+n2013	.fill	n561
+n2014	.fill	n3220
+n2015	.fill	n2111
+n2016	.fill	n2203
+n2017	.fill	n3969
+n2018	.fill	n4063
+n2019	.fill	n2247
+n2020	.fill	n1235
+n2021	.fill	n2795
+n2022	.fill	n1123
+n2023	.fill	n2566
+n2024	.fill	n551
+n2025	.fill	n2205
+n2026	.fill	n395
+n2027	.fill	n2122
+n2028	.fill	n341
+n2029	.fill	n3074
+n2030	.fill	n1681
+n2031	.fill	n207
+n2032	.fill	n3741
+n2033	.fill	n2287
+n2034	.fill	n1150
+n2035	.fill	n398
+n2036	.fill	n1967
+n2037	.fill	n3870
+n2038	.fill	n4008
+n2039	.fill	n3802
+n2040	.fill	n2856
+n2041	.fill	n2231
+n2042	.fill	n1615
+n2043	.fill	n2080
+n2044	.fill	n1471
+n2045	.fill	n2996
+n2046	.fill	n745
+n2047	.fill	n157
+n2048	.fill	n2769
+n2049	.fill	n2764
+n2050	.fill	n2565
+n2051	.fill	n3172
+n2052	.fill	n89
+n2053	.fill	n4086
+n2054	.fill	n3314
+n2055	.fill	n1776
+n2056	.fill	n1038
+n2057	.fill	n372
+n2058	.fill	n845
+n2059	.fill	n3257
+n2060	.fill	n3395
+n2061	.fill	n156
+n2062	.fill	n3812
+n2063	.fill	n2698
+n2064	.fill	n3389
+n2065	.fill	n1694
+n2066	.fill	n1527
+n2067	.fill	n1723
+n2068	.fill	n1974
+n2069	.fill	n3222
+n2070	.fill	n51
+n2071	.fill	n710
+n2072	.fill	n2374
+n2073	.fill	n1468
+n2074	.fill	n431
+n2075	.fill	n3470
+n2076	.fill	n1524
+n2077	.fill	n671
+n2078	.fill	n1217
+n2079	.fill	n1395
+n2080	.fill	n1368
+n2081	.fill	n3210
+n2082	.fill	n1840
+n2083	.fill	n770
+n2084	.fill	n1032
+n2085	.fill	n379
+n2086	.fill	n2037
+n2087	.fill	n942
+n2088	.fill	n468
+n2089	.fill	n196
+n2090	.fill	n1440
+n2091	.fill	n703
+n2092	.fill	n3330
+n2093	.fill	n3417
+n2094	.fill	n952
+n2095	.fill	n2171
+n2096	.fill	n2372
+n2097	.fill	n2252
+n2098	.fill	n2216
+n2099	.fill	n2268
+n2100	.fill	n1198
+n2101	.fill	n1230
+n2102	.fill	n1989
+n2103	.fill	n1297
+n2104	.fill	n2168
+n2105	.fill	n1523
+n2106	.fill	n1980
+n2107	.fill	n1778
+n2108	.fill	n442
+n2109	.fill	n405
+n2110	.fill	n938
+n2111	.fill	n2936
+n2112	.fill	n499
+n2113	.fill	n3045
+n2114	.fill	n2145
+n2115	.fill	n4054
+n2116	.fill	n829
+n2117	.fill	n3095
+n2118	.fill	n809
+n2119	.fill	n2732
+n2120	.fill	n693
+n2121	.fill	n3725
+n2122	.fill	n3235
+n2123	.fill	n2312
+n2124	.fill	n972
+n2125	.fill	n1777
+n2126	.fill	n3952
+n2127	.fill	n1819
+n2128	.fill	n3701
+n2129	.fill	n367
+n2130	.fill	n3067
+n2131	.fill	n3405
+n2132	.fill	n2765
+n2133	.fill	n3306
+n2134	.fill	n0
+n2135	.fill	n420
+n2136	.fill	n2426
+n2137	.fill	n2598
+n2138	.fill	n225
+n2139	.fill	n246
+n2140	.fill	n2492
+n2141	.fill	n3233
+n2142	.fill	n3939
+n2143	.fill	n814
+n2144	.fill	n2215
+n2145	.fill	n1295
+n2146	.fill	n2600
+n2147	.fill	n1338
+n2148	.fill	n3036
+n2149	.fill	n1219
+n2150	.fill	n636
+n2151	.fill	n1764
+n2152	.fill	n1352
+n2153	.fill	n3378
+n2154	.fill	n1715
+n2155	.fill	n1936
+n2156	.fill	n1903
+n2157	.fill	n1953
+n2158	.fill	n2305
+n2159	.fill	n811
+n2160	.fill	n2805
+n2161	.fill	n2991
+n2162	.fill	n3787
+n2163	.fill	n3967
+n2164	.fill	n587
+n2165	.fill	n8
+n2166	.fill	n3209
+n2167	.fill	n1968
+n2168	.fill	n996
+n2169	.fill	n3793
+n2170	.fill	n2062
+n2171	.fill	n4021
+n2172	.fill	n3490
+n2173	.fill	n1682
+n2174	.fill	n3847
+n2175	.fill	n2199
+n2176	.fill	n1809
+n2177	.fill	n1774
+n2178	.fill	n1183
+n2179	.fill	n612
+n2180	.fill	n2454
+n2181	.fill	n940
+n2182	.fill	n3975
+n2183	.fill	n350
+n2184	.fill	n1406
+n2185	.fill	n3693
+n2186	.fill	n2970
+n2187	.fill	n2010
+n2188	.fill	n682
+n2189	.fill	n3147
+n2190	.fill	n3713
+n2191	.fill	n1225
+n2192	.fill	n1218
+n2193	.fill	n1695
+n2194	.fill	n779
+n2195	.fill	n3161
+n2196	.fill	n2910
+n2197	.fill	n1366
+n2198	.fill	n2363
+n2199	.fill	n3346
+n2200	.fill	n1388
+n2201	.fill	n3832
+n2202	.fill	n3185
+n2203	.fill	n1788
+n2204	.fill	n1564
+n2205	.fill	n707
+n2206	.fill	n3326
+n2207	.fill	n1631
+n2208	.fill	n2872
+n2209	.fill	n1431
+n2210	.fill	n2662
+n2211	.fill	n668
+n2212	.fill	n491
+n2213	.fill	n1349
+n2214	.fill	n3017
+n2215	.fill	n1520
+n2216	.fill	n3382
+n2217	.fill	n1153
+n2218	.fill	n2442
+n2219	.fill	n3694
+n2220	.fill	n1958
+n2221	.fill	n2980
+n2222	.fill	n2987
+n2223	.fill	n2292
+n2224	.fill	n1982
+n2225	.fill	n2655
+n2226	.fill	n855
+n2227	.fill	n3806
+n2228	.fill	n1137
+n2229	.fill	n2943
+n2230	.fill	n2539
+n2231	.fill	n4010
+n2232	.fill	n2005
+n2233	.fill	n3275
+n2234	.fill	n1785
+n2235	.fill	n1835
+n2236	.fill	n2658
+n2237	.fill	n2490
+n2238	.fill	n2567
+n2239	.fill	n483
+n2240	.fill	n120
+n2241	.fill	n2614
+n2242	.fill	n1838
+n2243	.fill	n4032
+n2244	.fill	n2058
+n2245	.fill	n2337
+n2246	.fill	n727
+n2247	.fill	n3905
+n2248	.fill	n3547
+n2249	.fill	n3619
+n2250	.fill	n1537
+n2251	.fill	n915
+n2252	.fill	n3344
+n2253	.fill	n3996
+n2254	.fill	n1145
+n2255	.fill	n3412
+n2256	.fill	n2908
+n2257	.fill	n3118
+n2258	.fill	n3334
+n2259	.fill	n3588
+n2260	.fill	n2110
+n2261	.fill	n1639
+n2262	.fill	n715
+n2263	.fill	n375
+n2264	.fill	n3744
+n2265	.fill	n571
+n2266	.fill	n2133
+n2267	.fill	n2793
+n2268	.fill	n2663
+n2269	.fill	n724
+n2270	.fill	n3933
+n2271	.fill	n1720
+n2272	.fill	n3191
+n2273	.fill	n1382
+n2274	.fill	n1088
+n2275	.fill	n1454
+n2276	.fill	n3563
+n2277	.fill	n353
+n2278	.fill	n15
+n2279	.fill	n2544
+n2280	.fill	n841
+n2281	.fill	n3696
+n2282	.fill	n2321
+n2283	.fill	n2260
+n2284	.fill	n4092
+n2285	.fill	n3426
+n2286	.fill	n775
+n2287	.fill	n1022
+n2288	.fill	n2258
+n2289	.fill	n4044
+n2290	.fill	n3236
+n2291	.fill	n2318
+n2292	.fill	n248
+n2293	.fill	n301
+n2294	.fill	n2977
+n2295	.fill	n3499
+n2296	.fill	n869
+n2297	.fill	n2680
+n2298	.fill	n1030
+n2299	.fill	n2942
+n2300	.fill	n595
+n2301	.fill	n2504
+n2302	.fill	n3121
+n2303	.fill	n2407
+n2304	.fill	n2503
+n2305	.fill	n574
+n2306	.fill	n2814
+n2307	.fill	n3583
+n2308	.fill	n2087
+n2309	.fill	n939
+n2310	.fill	n2649
+n2311	.fill	n1261
+n2312	.fill	n1977
+n2313	.fill	n3686
+n2314	.fill	n3392
+n2315	.fill	n3225
+n2316	.fill	n3756
+n2317	.fill	n3258
+n2318	.fill	n3400
+n2319	.fill	n2914
+n2320	.fill	n3445
+n2321	.fill	n1350
+n2322	.fill	n1020
+n2323	.fill	n1517
+n2324	.fill	n2868
+n2325	.fill	n467
+n2326	.fill	n2160
+n2327	.fill	n2953
+n2328	.fill	n3353
+n2329	.fill	n2296
+n2330	.fill	n1929
+n2331	.fill	n806
+n2332	.fill	n3890
+n2333	.fill	n1509
+n2334	.fill	n1633
+n2335	.fill	n2254
+n2336	.fill	n1879
+n2337	.fill	n1280
+n2338	.fill	n1550
+n2339	.fill	n3584
+n2340	.fill	n1583
+n2341	.fill	n3394
+n2342	.fill	n3472
+n2343	.fill	n943
+n2344	.fill	n2425
+n2345	.fill	n234
+n2346	.fill	n920
+n2347	.fill	n211
+n2348	.fill	n235
+n2349	.fill	n2351
+n2350	.fill	n804
+n2351	.fill	n2017
+n2352	.fill	n765
+n2353	.fill	n4088
+n2354	.fill	n369
+n2355	.fill	n3529
+n2356	.fill	n2776
+n2357	.fill	n2067
+n2358	.fill	n1007
+n2359	.fill	n3440
+n2360	.fill	n155
+n2361	.fill	n1322
+n2362	.fill	n3607
+n2363	.fill	n2540
+n2364	.fill	n2731
+n2365	.fill	n2611
+n2366	.fill	n630
+n2367	.fill	n3071
+n2368	.fill	n3599
+n2369	.fill	n861
+n2370	.fill	n303
+n2371	.fill	n2559
+n2372	.fill	n160
+n2373	.fill	n613
+n2374	.fill	n1209
+n2375	.fill	n3846
+n2376	.fill	n97
+n2377	.fill	n1911
+n2378	.fill	n1692
+n2379	.fill	n3796
+n2380	.fill	n3652
+n2381	.fill	n1144
+n2382	.fill	n376
+n2383	.fill	n474
+n2384	.fill	n2124
+n2385	.fill	n421
+n2386	.fill	n995
+n2387	.fill	n3467
+n2388	.fill	n2474
+n2389	.fill	n1673
+n2390	.fill	n3618
+n2391	.fill	n3427
+n2392	.fill	n1881
+n2393	.fill	n1422
+n2394	.fill	n2846
+n2395	.fill	n2782
+n2396	.fill	n2721
+n2397	.fill	n1579
+n2398	.fill	n3555
+n2399	.fill	n1627
+n2400	.fill	n1466
+n2401	.fill	n3040
+n2402	.fill	n2377
+n2403	.fill	n2862
+n2404	.fill	n2322
+n2405	.fill	n2419
+n2406	.fill	n2902
+n2407	.fill	n778
+n2408	.fill	n1919
+n2409	.fill	n2249
+n2410	.fill	n3673
+n2411	.fill	n2453
+n2412	.fill	n1268
+n2413	.fill	n409
+n2414	.fill	n2903
+n2415	.fill	n2024
+n2416	.fill	n2999
+n2417	.fill	n171
+n2418	.fill	n2737
+n2419	.fill	n1080
+n2420	.fill	n961
+n2421	.fill	n107
+n2422	.fill	n2041
+n2423	.fill	n562
+n2424	.fill	n607
+n2425	.fill	n3865
+n2426	.fill	n2069
+n2427	.fill	n2405
+n2428	.fill	n2532
+n2429	.fill	n1941
+n2430	.fill	n1334
+n2431	.fill	n1141
+n2432	.fill	n1770
+n2433	.fill	n725
+n2434	.fill	n3090
+n2435	.fill	n1138
+n2436	.fill	n292
+n2437	.fill	n2589
+n2438	.fill	n2253
+n2439	.fill	n528
+n2440	.fill	n1801
+n2441	.fill	n2607
+n2442	.fill	n2023
+n2443	.fill	n2281
+n2444	.fill	n4078
+n2445	.fill	n3300
+n2446	.fill	n1597
+n2447	.fill	n2248
+n2448	.fill	n3277
+n2449	.fill	n503
+n2450	.fill	n888
+n2451	.fill	n352
+n2452	.fill	n3240
+n2453	.fill	n3310
+n2454	.fill	n2364
+n2455	.fill	n1370
+n2456	.fill	n1390
+n2457	.fill	n800
+n2458	.fill	n834
+n2459	.fill	n2620
+n2460	.fill	n584
+n2461	.fill	n968
+n2462	.fill	n1724
+n2463	.fill	n4085
+n2464	.fill	n279
+n2465	.fill	n3481
+n2466	.fill	n3192
+n2467	.fill	n3039
+n2468	.fill	n2515
+n2469	.fill	n43
+n2470	.fill	n2359
+n2471	.fill	n3500
+n2472	.fill	n3735
+n2473	.fill	n1811
+n2474	.fill	n2723
+n2475	.fill	n1190
+n2476	.fill	n2422
+n2477	.fill	n3960
+n2478	.fill	n1134
+n2479	.fill	n4094
+n2480	.fill	n1853
+n2481	.fill	n884
+n2482	.fill	n4045
+n2483	.fill	n342
+n2484	.fill	n1486
+n2485	.fill	n547
+n2486	.fill	n1915
+n2487	.fill	n1330
+n2488	.fill	n979
+n2489	.fill	n3749
+n2490	.fill	n3904
+n2491	.fill	n2482
+n2492	.fill	n653
+n2493	.fill	n2947
+n2494	.fill	n3416
+n2495	.fill	n2317
+n2496	.fill	n213
+n2497	.fill	n991
+n2498	.fill	n1539
+n2499	.fill	n3215
+n2500	.fill	n1765
+n2501	.fill	n2802
+n2502	.fill	n2345
+n2503	.fill	n1769
+n2504	.fill	n131
+n2505	.fill	n2054
+n2506	.fill	n3550
+n2507	.fill	n377
+n2508	.fill	n3262
+n2509	.fill	n3360
+n2510	.fill	n2331
+n2511	.fill	n283
+n2512	.fill	n1447
+n2513	.fill	n3361
+n2514	.fill	n19
+n2515	.fill	n3766
+n2516	.fill	n3342
+n2517	.fill	n2002
+n2518	.fill	n3894
+n2519	.fill	n3900
+n2520	.fill	n565
+n2521	.fill	n726
+n2522	.fill	n327
+n2523	.fill	n3169
+n2524	.fill	n1171
+n2525	.fill	n1488
+n2526	.fill	n1226
+n2527	.fill	n752
+n2528	.fill	n1910
+n2529	.fill	n570
+n2530	.fill	n771
+n2531	.fill	n2781
+n2532	.fill	n2879
+n2533	.fill	n333
+n2534	.fill	n3278
+n2535	.fill	n3435
+n2536	.fill	n698
+n2537	.fill	n463
+n2538	.fill	n1963
+n2539	.fill	n1581
+n2540	.fill	n1821
+n2541	.fill	n438
+n2542	.fill	n14
+n2543	.fill	n609
+n2544	.fill	n627
+n2545	.fill	n1114
+n2546	.fill	n69
+n2547	.fill	n1273
+n2548	.fill	n2847
+n2549	.fill	n625
+n2550	.fill	n3722
+n2551	.fill	n1814
+n2552	.fill	n3898
+n2553	.fill	n476
+n2554	.fill	n2361
+n2555	.fill	n1617
+n2556	.fill	n3598
+n2557	.fill	n709
+n2558	.fill	n3397
+n2559	.fill	n2116
+n2560	.fill	n2385
+n2561	.fill	n456
+n2562	.fill	n3448
+n2563	.fill	n898
+n2564	.fill	n119
+n2565	.fill	n990
+n2566	.fill	n2396
+n2567	.fill	n1205
+n2568	.fill	n3289
+n2569	.fill	n3643
+n2570	.fill	n458
+n2571	.fill	n3920
+n2572	.fill	n2816
+n2573	.fill	n2643
+n2574	.fill	n877
+n2575	.fill	n1544
+n2576	.fill	n3977
+n2577	.fill	n1084
+n2578	.fill	n2440
+n2579	.fill	n1083
+n2580	.fill	n4050
+n2581	.fill	n2563
+n2582	.fill	n149
+n2583	.fill	n1897
+n2584	.fill	n1628
+n2585	.fill	n1376
+n2586	.fill	n1817
+n2587	.fill	n2413
+n2588	.fill	n1043
+n2589	.fill	n3889
+n2590	.fill	n1400
+n2591	.fill	n3763
+n2592	.fill	n2085
+n2593	.fill	n2768
+n2594	.fill	n2222
+n2595	.fill	n1806
+n2596	.fill	n597
+n2597	.fill	n239
+n2598	.fill	n614
+n2599	.fill	n154
+n2600	.fill	n96
+n2601	.fill	n3585
+n2602	.fill	n3919
+n2603	.fill	n1645
+n2604	.fill	n1688
+n2605	.fill	n1999
+n2606	.fill	n448
+n2607	.fill	n180
+n2608	.fill	n2584
+n2609	.fill	n454
+n2610	.fill	n3883
+n2611	.fill	n1562
+n2612	.fill	n428
+n2613	.fill	n74
+n2614	.fill	n2850
+n2615	.fill	n4034
+n2616	.fill	n1073
+n2617	.fill	n3655
+n2618	.fill	n956
+n2619	.fill	n701
+n2620	.fill	n1143
+n2621	.fill	n148
+n2622	.fill	n3078
+n2623	.fill	n299
+n2624	.fill	n3926
+n2625	.fill	n714
+n2626	.fill	n2243
+n2627	.fill	n1332
+n2628	.fill	n39
+n2629	.fill	n302
+n2630	.fill	n675
+n2631	.fill	n1052
+n2632	.fill	n2853
+n2633	.fill	n1669
+n2634	.fill	n602
+n2635	.fill	n1739
+n2636	.fill	n3677
+n2637	.fill	n2946
+n2638	.fill	n2670
+n2639	.fill	n632
+n2640	.fill	n1758
+n2641	.fill	n3849
+n2642	.fill	n2967
+n2643	.fill	n9
+n2644	.fill	n1709
+n2645	.fill	n1800
+n2646	.fill	n549
+n2647	.fill	n3390
+n2648	.fill	n1287
+n2649	.fill	n3245
+n2650	.fill	n599
+n2651	.fill	n2648
+n2652	.fill	n3790
+n2653	.fill	n2938
+n2654	.fill	n1734
+n2655	.fill	n3662
+n2656	.fill	n3177
+n2657	.fill	n3656
+n2658	.fill	n391
+n2659	.fill	n3229
+n2660	.fill	n471
+n2661	.fill	n3526
+n2662	.fill	n371
+n2663	.fill	n296
+n2664	.fill	n1013
+n2665	.fill	n2818
+n2666	.fill	n4073
+n2667	.fill	n2397
+n2668	.fill	n896
+n2669	.fill	n3239
+n2670	.fill	n2433
+n2671	.fill	n2928
+n2672	.fill	n1236
+n2673	.fill	n87
+n2674	.fill	n142
+n2675	.fill	n1653
+n2676	.fill	n2861
+n2677	.fill	n2441
+n2678	.fill	n862
+n2679	.fill	n217
+n2680	.fill	n3073
+n2681	.fill	n2779
+n2682	.fill	n3503
+n2683	.fill	n852
+n2684	.fill	n2854
+n2685	.fill	n3116
+n2686	.fill	n1372
+n2687	.fill	n3345
+n2688	.fill	n1676
+n2689	.fill	n3961
+n2690	.fill	n3076
+n2691	.fill	n3221
+n2692	.fill	n1262
+n2693	.fill	n2461
+n2694	.fill	n354
+n2695	.fill	n2548
+n2696	.fill	n3949
+n2697	.fill	n3143
+n2698	.fill	n3
+n2699	.fill	n2115
+n2700	.fill	n2637
+n2701	.fill	n3092
+n2702	.fill	n44
+n2703	.fill	n3170
+n2704	.fill	n324
+n2705	.fill	n260
+n2706	.fill	n3508
+n2707	.fill	n2749
+n2708	.fill	n3133
+n2709	.fill	n222
+n2710	.fill	n2555
+n2711	.fill	n3818
+n2712	.fill	n2595
+n2713	.fill	n3041
+n2714	.fill	n4090
+n2715	.fill	n2114
+n2716	.fill	n3786
+n2717	.fill	n868
+n2718	.fill	n2061
+n2719	.fill	n150
+n2720	.fill	n143
+n2721	.fill	n2032
+n2722	.fill	n3101
+n2723	.fill	n1222
+n2724	.fill	n242
+n2725	.fill	n3455
+n2726	.fill	n1285
+n2727	.fill	n2417
+n2728	.fill	n3260
+n2729	.fill	n4068
+n2730	.fill	n3269
+n2731	.fill	n3272
+n2732	.fill	n3411
+n2733	.fill	n134
+n2734	.fill	n2084
+n2735	.fill	n3131
+n2736	.fill	n2875
+n2737	.fill	n2409
+n2738	.fill	n2078
+n2739	.fill	n1031
+n2740	.fill	n1678
+n2741	.fill	n175
+n2742	.fill	n271
+n2743	.fill	n2601
+n2744	.fill	n3860
+n2745	.fill	n2692
+n2746	.fill	n3208
+n2747	.fill	n3664
+n2748	.fill	n3354
+n2749	.fill	n2671
+n2750	.fill	n881
+n2751	.fill	n864
+n2752	.fill	n3675
+n2753	.fill	n2631
+n2754	.fill	n2480
+n2755	.fill	n3887
+n2756	.fill	n2941
+n2757	.fill	n634
+n2758	.fill	n2325
+n2759	.fill	n1640
+n2760	.fill	n3953
+n2761	.fill	n3424
+n2762	.fill	n3734
+n2763	.fill	n631
+n2764	.fill	n542
+n2765	.fill	n3377
+n2766	.fill	n807
+n2767	.fill	n1614
+n2768	.fill	n917
+n2769	.fill	n3403
+n2770	.fill	n1990
+n2771	.fill	n3356
+n2772	.fill	n48
+n2773	.fill	n2416
+n2774	.fill	n1935
+n2775	.fill	n3190
+n2776	.fill	n2291
+n2777	.fill	n328
+n2778	.fill	n2096
+n2779	.fill	n3617
+n2780	.fill	n490
+n2781	.fill	n3444
+n2782	.fill	n2098
+n2783	.fill	n2259
+n2784	.fill	n740
+n2785	.fill	n3721
+n2786	.fill	n1895
+n2787	.fill	n3211
+n2788	.fill	n910
+n2789	.fill	n1680
+n2790	.fill	n1960
+n2791	.fill	n2635
+n2792	.fill	n2557
+n2793	.fill	n1964
+n2794	.fill	n3451
+n2795	.fill	n2283
+n2796	.fill	n541
+n2797	.fill	n3774
+n2798	.fill	n3966
+n2799	.fill	n2381
+n2800	.fill	n1511
+n2801	.fill	n2992
+n2802	.fill	n4059
+n2803	.fill	n1058
+n2804	.fill	n163
+n2805	.fill	n512
+n2806	.fill	n3837
+n2807	.fill	n1423
+n2808	.fill	n3687
+n2809	.fill	n2169
+n2810	.fill	n3320
+n2811	.fill	n926
+n2812	.fill	n1250
+n2813	.fill	n907
+n2814	.fill	n1046
+n2815	.fill	n959
+n2816	.fill	n251
+n2817	.fill	n1109
+n2818	.fill	n2949
+n2819	.fill	n3758
+n2820	.fill	n4076
+n2821	.fill	n816
+n2822	.fill	n493
+n2823	.fill	n3596
+n2824	.fill	n1244
+n2825	.fill	n3634
+n2826	.fill	n73
+n2827	.fill	n2873
+n2828	.fill	n117
+n2829	.fill	n3631
+n2830	.fill	n1841
+n2831	.fill	n2056
+n2832	.fill	n922
+n2833	.fill	n2669
+n2834	.fill	n2314
+n2835	.fill	n3610
+n2836	.fill	n2794
+n2837	.fill	n2622
+n2838	.fill	n3921
+n2839	.fill	n3431
+n2840	.fill	n2885
+n2841	.fill	n2137
+n2842	.fill	n3329
+n2843	.fill	n3672
+n2844	.fill	n2596
+n2845	.fill	n330
+n2846	.fill	n2438
+n2847	.fill	n941
+n2848	.fill	n3874
+n2849	.fill	n969
+n2850	.fill	n1470
+n2851	.fill	n3536
+n2852	.fill	n713
+n2853	.fill	n733
+n2854	.fill	n3868
+n2855	.fill	n3564
+n2856	.fill	n1089
+n2857	.fill	n47
+n2858	.fill	n790
+n2859	.fill	n4013
+n2860	.fill	n1033
+n2861	.fill	n389
+n2862	.fill	n191
+n2863	.fill	n1428
+n2864	.fill	n629
+n2865	.fill	n3368
+n2866	.fill	n1459
+n2867	.fill	n1166
+n2868	.fill	n4089
+n2869	.fill	n3819
+n2870	.fill	n637
+n2871	.fill	n169
+n2872	.fill	n2866
+n2873	.fill	n1034
+n2874	.fill	n3447
+n2875	.fill	n1017
+n2876	.fill	n2521
+n2877	.fill	n3720
+n2878	.fill	n3102
+n2879	.fill	n1472
+n2880	.fill	n2959
+n2881	.fill	n2727
+n2882	.fill	n264
+n2883	.fill	n2869
+n2884	.fill	n2140
+n2885	.fill	n3803
+n2886	.fill	n1555
+n2887	.fill	n1195
+n2888	.fill	n1506
+n2889	.fill	n2086
+n2890	.fill	n3383
+n2891	.fill	n3002
+n2892	.fill	n2119
+n2893	.fill	n2848
+n2894	.fill	n1185
+n2895	.fill	n3483
+n2896	.fill	n3054
+n2897	.fill	n3711
+n2898	.fill	n202
+n2899	.fill	n3046
+n2900	.fill	n1670
+n2901	.fill	n2629
+n2902	.fill	n3629
+n2903	.fill	n3574
+n2904	.fill	n2994
+n2905	.fill	n1771
+n2906	.fill	n3918
+n2907	.fill	n1810
+n2908	.fill	n2053
+n2909	.fill	n1223
+n2910	.fill	n734
+n2911	.fill	n763
+n2912	.fill	n2871
+n2913	.fill	n1966
+n2914	.fill	n404
+n2915	.fill	n3747
+n2916	.fill	n3231
+n2917	.fill	n695
+n2918	.fill	n647
+n2919	.fill	n3535
+n2920	.fill	n3449
+n2921	.fill	n3454
+n2922	.fill	n3866
+n2923	.fill	n648
+n2924	.fill	n223
+n2925	.fill	n2348
+n2926	.fill	n3298
+n2927	.fill	n1610
+n2928	.fill	n2636
+n2929	.fill	n581
+n2930	.fill	n3319
+n2931	.fill	n340
+n2932	.fill	n3404
+n2933	.fill	n2874
+n2934	.fill	n681
+n2935	.fill	n2581
+n2936	.fill	n2934
+n2937	.fill	n1387
+n2938	.fill	n70
+n2939	.fill	n3614
+n2940	.fill	n289
+n2941	.fill	n1464
+n2942	.fill	n2411
+n2943	.fill	n3379
+n2944	.fill	n2852
+n2945	.fill	n1358
+n2946	.fill	n3990
+n2947	.fill	n1820
+n2948	.fill	n1460
+n2949	.fill	n2748
+n2950	.fill	n1993
+n2951	.fill	n617
+n2952	.fill	n2927
+n2953	.fill	n2467
+n2954	.fill	n517
+n2955	.fill	n3061
+n2956	.fill	n1855
+n2957	.fill	n2059
+n2958	.fill	n3327
+n2959	.fill	n2095
+n2960	.fill	n2791
+n2961	.fill	n3186
+n2962	.fill	n3540
+n2963	.fill	n3730
+n2964	.fill	n77
+n2965	.fill	n2201
+n2966	.fill	n3543
+n2967	.fill	n2630
+n2968	.fill	n2697
+n2969	.fill	n1921
+n2970	.fill	n977
+n2971	.fill	n916
+n2972	.fill	n3340
+n2973	.fill	n1267
+n2974	.fill	n1773
+n2975	.fill	n2341
+n2976	.fill	n2956
+n2977	.fill	n290
+n2978	.fill	n3700
+n2979	.fill	n796
+n2980	.fill	n164
+n2981	.fill	n60
+n2982	.fill	n2410
+n2983	.fill	n2327
+n2984	.fill	n478
+n2985	.fill	n764
+n2986	.fill	n1041
+n2987	.fill	n2466
+n2988	.fill	n539
+n2989	.fill	n903
+n2990	.fill	n1146
+n2991	.fill	n2541
+n2992	.fill	n2916
+n2993	.fill	n2821
+n2994	.fill	n953
+n2995	.fill	n247
+n2996	.fill	n481
+n2997	.fill	n593
+n2998	.fill	n473
+n2999	.fill	n1119
+n3000	.fill	n2390
+n3001	.fill	n2163
+n3002	.fill	n2547
+n3003	.fill	n3621
+n3004	.fill	n1549
+n3005	.fill	n3033
+n3006	.fill	n1592
+n3007	.fill	n141
+n3008	.fill	n2487
+n3009	.fill	n4020
+n3010	.fill	n320
+n3011	.fill	n535
+n3012	.fill	n833
+n3013	.fill	n3422
+n3014	.fill	n1173
+n3015	.fill	n3324
+n3016	.fill	n3396
+n3017	.fill	n1531
+n3018	.fill	n1697
+n3019	.fill	n3373
+n3020	.fill	n3854
+n3021	.fill	n3179
+n3022	.fill	n854
+n3023	.fill	n2617
+n3024	.fill	n401
+n3025	.fill	n2582
+n3026	.fill	n1304
+n3027	.fill	n3682
+n3028	.fill	n1567
+n3029	.fill	n911
+n3030	.fill	n3029
+n3031	.fill	n2428
+n3032	.fill	n2702
+n3033	.fill	n3661
+n3034	.fill	n300
+n3035	.fill	n843
+n3036	.fill	n1298
+n3037	.fill	n1987
+n3038	.fill	n1532
+n3039	.fill	n2924
+n3040	.fill	n1411
+n3041	.fill	n826
+n3042	.fill	n1247
+n3043	.fill	n2899
+n3044	.fill	n2207
+n3045	.fill	n4079
+n3046	.fill	n3759
+n3047	.fill	n3929
+n3048	.fill	n2469
+n3049	.fill	n3339
+n3050	.fill	n167
+n3051	.fill	n2334
+n3052	.fill	n172
+n3053	.fill	n1991
+n3054	.fill	n3261
+n3055	.fill	n3159
+n3056	.fill	n2414
+n3057	.fill	n1745
+n3058	.fill	n276
+n3059	.fill	n1241
+n3060	.fill	n1092
+n3061	.fill	n2079
+n3062	.fill	n3486
+n3063	.fill	n2562
+n3064	.fill	n893
+n3065	.fill	n3840
+n3066	.fill	n2688
+n3067	.fill	n3927
+n3068	.fill	n2320
+n3069	.fill	n3130
+n3070	.fill	n3243
+n3071	.fill	n2650
+n3072	.fill	n1252
+n3073	.fill	n3388
+n3074	.fill	n3680
+n3075	.fill	n642
+n3076	.fill	n1199
+n3077	.fill	n3027
+n3078	.fill	n81
+n3079	.fill	n1424
+n3080	.fill	n4062
+n3081	.fill	n3115
+n3082	.fill	n1130
+n3083	.fill	n3461
+n3084	.fill	n1482
+n3085	.fill	n284
+n3086	.fill	n2664
+n3087	.fill	n3466
+n3088	.fill	n2264
+n3089	.fill	n3703
+n3090	.fill	n2817
+n3091	.fill	n2579
+n3092	.fill	n3267
+n3093	.fill	n1133
+n3094	.fill	n3546
+n3095	.fill	n1380
+n3096	.fill	n3207
+n3097	.fill	n1514
+n3098	.fill	n3724
+n3099	.fill	n2090
+n3100	.fill	n3398
+n3101	.fill	n2269
+n3102	.fill	n244
+n3103	.fill	n2742
+n3104	.fill	n1154
+n3105	.fill	n385
+n3106	.fill	n2986
+n3107	.fill	n3674
+n3108	.fill	n3852
+n3109	.fill	n2456
+n3110	.fill	n1654
+n3111	.fill	n2303
+n3112	.fill	n3428
+n3113	.fill	n504
+n3114	.fill	n2375
+n3115	.fill	n1761
+n3116	.fill	n1561
+n3117	.fill	n1289
+n3118	.fill	n2900
+n3119	.fill	n2360
+n3120	.fill	n4028
+n3121	.fill	n2918
+n3122	.fill	n1093
+n3123	.fill	n2167
+n3124	.fill	n297
+n3125	.fill	n4007
+n3126	.fill	n3284
+n3127	.fill	n3163
+n3128	.fill	n552
+n3129	.fill	n1598
+n3130	.fill	n2193
+n3131	.fill	n3608
+n3132	.fill	n3136
+n3133	.fill	n4012
+n3134	.fill	n3513
+n3135	.fill	n812
+n3136	.fill	n3761
+n3137	.fill	n2194
+n3138	.fill	n1705
+n3139	.fill	n1984
+n3140	.fill	n2394
+n3141	.fill	n3959
+n3142	.fill	n1948
+n3143	.fill	n83
+n3144	.fill	n2543
+n3145	.fill	n1622
+n3146	.fill	n1684
+n3147	.fill	n1357
+n3148	.fill	n3296
+n3149	.fill	n2933
+n3150	.fill	n1909
+n3151	.fill	n1789
+n3152	.fill	n2120
+n3153	.fill	n2523
+n3154	.fill	n1259
+n3155	.fill	n1949
+n3156	.fill	n1286
+n3157	.fill	n1862
+n3158	.fill	n2493
+n3159	.fill	n3098
+n3160	.fill	n430
+n3161	.fill	n1580
+n3162	.fill	n2315
+n3163	.fill	n2210
+n3164	.fill	n822
+n3165	.fill	n3155
+n3166	.fill	n508
+n3167	.fill	n3698
+n3168	.fill	n2813
+n3169	.fill	n397
+n3170	.fill	n2642
+n3171	.fill	n853
+n3172	.fill	n3338
+n3173	.fill	n2434
+n3174	.fill	n1816
+n3175	.fill	n3315
+n3176	.fill	n3556
+n3177	.fill	n3230
+n3178	.fill	n2354
+n3179	.fill	n1647
+n3180	.fill	n317
+n3181	.fill	n3776
+n3182	.fill	n1924
+n3183	.fill	n3764
+n3184	.fill	n582
+n3185	.fill	n2777
+n3186	.fill	n506
+n3187	.fill	n1371
+n3188	.fill	n776
+n3189	.fill	n1116
+n3190	.fill	n1970
+n3191	.fill	n3752
+n3192	.fill	n3044
+n3193	.fill	n1954
+n3194	.fill	n381
+n3195	.fill	n3022
+n3196	.fill	n3622
+n3197	.fill	n3820
+n3198	.fill	n576
+n3199	.fill	n1854
+n3200	.fill	n71
+n3201	.fill	n2799
+n3202	.fill	n3925
+n3203	.fill	n791
+n3204	.fill	n1526
+n3205	.fill	n1872
+n3206	.fill	n1833
+n3207	.fill	n2568
+n3208	.fill	n1333
+n3209	.fill	n2644
+n3210	.fill	n2063
+n3211	.fill	n1861
+n3212	.fill	n3788
+n3213	.fill	n3025
+n3214	.fill	n2881
+n3215	.fill	n3917
+n3216	.fill	n1396
+n3217	.fill	n1200
+n3218	.fill	n1570
+n3219	.fill	n233
+n3220	.fill	n1710
+n3221	.fill	n2118
+n3222	.fill	n2796
+n3223	.fill	n1865
+n3224	.fill	n2015
+n3225	.fill	n4084
+n3226	.fill	n3234
+n3227	.fill	n2485
+n3228	.fill	n1791
+n3229	.fill	n295
+n3230	.fill	n559
+n3231	.fill	n1216
+n3232	.fill	n2755
+n3233	.fill	n2672
+n3234	.fill	n2065
+n3235	.fill	n563
+n3236	.fill	n3418
+n3237	.fill	n3581
+n3238	.fill	n987
+n3239	.fill	n1892
+n3240	.fill	n3948
+n3241	.fill	n288
+n3242	.fill	n591
+n3243	.fill	n1850
+n3244	.fill	n666
+n3245	.fill	n1475
+n3246	.fill	n416
+n3247	.fill	n2226
+n3248	.fill	n2378
+n3249	.fill	n3542
+n3250	.fill	n2219
+n3251	.fill	n2531
+n3252	.fill	n55
+n3253	.fill	n114
+n3254	.fill	n3944
+n3255	.fill	n3247
+n3256	.fill	n3232
+n3257	.fill	n2070
+n3258	.fill	n258
+n3259	.fill	n2403
+n3260	.fill	n1596
+n3261	.fill	n1736
+n3262	.fill	n199
+n3263	.fill	n484
+n3264	.fill	n3606
+n3265	.fill	n3283
+n3266	.fill	n1255
+n3267	.fill	n2657
+n3268	.fill	n2551
+n3269	.fill	n672
+n3270	.fill	n2278
+n3271	.fill	n3891
+n3272	.fill	n2633
+n3273	.fill	n3255
+n3274	.fill	n2625
+n3275	.fill	n3408
+n3276	.fill	n1784
+n3277	.fill	n2074
+n3278	.fill	n3280
+n3279	.fill	n3640
+n3280	.fill	n2009
+n3281	.fill	n1331
+n3282	.fill	n3266
+n3283	.fill	n2921
+n3284	.fill	n1842
+n3285	.fill	n1612
+n3286	.fill	n692
+n3287	.fill	n94
+n3288	.fill	n206
+n3289	.fill	n1827
+n3290	.fill	n3772
+n3291	.fill	n1708
+n3292	.fill	n650
+n3293	.fill	n3183
+n3294	.fill	n603
+n3295	.fill	n649
+n3296	.fill	n1
+n3297	.fill	n2401
+n3298	.fill	n652
+n3299	.fill	n84
+n3300	.fill	n3134
+n3301	.fill	n444
+n3302	.fill	n1638
+n3303	.fill	n1177
+n3304	.fill	n1652
+n3305	.fill	n3688
+n3306	.fill	n623
+n3307	.fill	n1210
+n3308	.fill	n857
+n3309	.fill	n4055
+n3310	.fill	n1389
+n3311	.fill	n2007
+n3312	.fill	n2696
+n3313	.fill	n355
+n3314	.fill	n1394
+n3315	.fill	n1407
+n3316	.fill	n3254
+n3317	.fill	n2931
+n3318	.fill	n3938
+n3319	.fill	n3058
+n3320	.fill	n889
+n3321	.fill	n2162
+n3322	.fill	n23
+n3323	.fill	n1451
+n3324	.fill	n1578
+n3325	.fill	n1917
+n3326	.fill	n3442
+n3327	.fill	n1519
+n3328	.fill	n2271
+n3329	.fill	n2822
+n3330	.fill	n3193
+n3331	.fill	n1227
+n3332	.fill	n1172
+n3333	.fill	n1721
+n3334	.fill	n2444
+n3335	.fill	n665
+n3336	.fill	n3896
+n3337	.fill	n4040
+n3338	.fill	n580
+n3339	.fill	n2108
+n3340	.fill	n3792
+n3341	.fill	n3246
+n3342	.fill	n2357
+n3343	.fill	n469
+n3344	.fill	n197
+n3345	.fill	n2064
+n3346	.fill	n359
+n3347	.fill	n882
+n3348	.fill	n2400
+n3349	.fill	n1353
+n3350	.fill	n2606
+n3351	.fill	n1607
+n3352	.fill	n2797
+n3353	.fill	n3771
+n3354	.fill	n3639
+n3355	.fill	n2886
+n3356	.fill	n578
+n3357	.fill	n2864
+n3358	.fill	n3104
+n3359	.fill	n4077
+n3360	.fill	n2227
+n3361	.fill	n1611
+n3362	.fill	n2297
+n3363	.fill	n674
+n3364	.fill	n79
+n3365	.fill	n287
+n3366	.fill	n3097
+n3367	.fill	n1942
+n3368	.fill	n3372
+n3369	.fill	n2076
+n3370	.fill	n1825
+n3371	.fill	n1624
+n3372	.fill	n1753
+n3373	.fill	n1272
+n3374	.fill	n2092
+n3375	.fill	n136
+n3376	.fill	n3999
+n3377	.fill	n1961
+n3378	.fill	n415
+n3379	.fill	n1619
+n3380	.fill	n2733
+n3381	.fill	n3718
+n3382	.fill	n2202
+n3383	.fill	n3857
+n3384	.fill	n2212
+n3385	.fill	n3434
+n3386	.fill	n1637
+n3387	.fill	n2640
+n3388	.fill	n678
+n3389	.fill	n2
+n3390	.fill	n3120
+n3391	.fill	n2338
+n3392	.fill	n1180
+n3393	.fill	n3945
+n3394	.fill	n2435
+n3395	.fill	n1284
+n3396	.fill	n1434
+n3397	.fill	n654
+n3398	.fill	n1045
+n3399	.fill	n3227
+n3400	.fill	n3087
+n3401	.fill	n1416
+n3402	.fill	n3282
+n3403	.fill	n1325
+n3404	.fill	n550
+n3405	.fill	n3063
+n3406	.fill	n3717
+n3407	.fill	n2200
+n3408	.fill	n3886
+n3409	.fill	n641
+n3410	.fill	n2455
+n3411	.fill	n3184
+n3412	.fill	n2022
+n3413	.fill	n3573
+n3414	.fill	n1805
+n3415	.fill	n1419
+n3416	.fill	n856
+n3417	.fill	n2001
+n3418	.fill	n146
+n3419	.fill	n2316
+n3420	.fill	n964
+n3421	.fill	n380
+n3422	.fill	n1118
+n3423	.fill	n498
+n3424	.fill	n2939
+n3425	.fill	n818
+n3426	.fill	n3006
+n3427	.fill	n3885
+n3428	.fill	n26
+n3429	.fill	n1629
+n3430	.fill	n1494
+n3431	.fill	n2342
+n3432	.fill	n688
+n3433	.fill	n351
+n3434	.fill	n374
+n3435	.fill	n823
+n3436	.fill	n3528
+n3437	.fill	n218
+n3438	.fill	n2553
+n3439	.fill	n3042
+n3440	.fill	n4029
+n3441	.fill	n115
+n3442	.fill	n2029
+n3443	.fill	n850
+n3444	.fill	n2645
+n3445	.fill	n2907
+n3446	.fill	n2302
+n3447	.fill	n1731
+n3448	.fill	n3561
+n3449	.fill	n4037
+n3450	.fill	n4049
+n3451	.fill	n3797
+n3452	.fill	n1775
+n3453	.fill	n422
+n3454	.fill	n2624
+n3455	.fill	n2344
+n3456	.fill	n2759
+n3457	.fill	n1700
+n3458	.fill	n732
+n3459	.fill	n32
+n3460	.fill	n622
+n3461	.fill	n187
+n3462	.fill	n1848
+n3463	.fill	n3506
+n3464	.fill	n275
+n3465	.fill	n436
+n3466	.fill	n1303
+n3467	.fill	n3858
+n3468	.fill	n780
+n3469	.fill	n2048
+n3470	.fill	n1112
+n3471	.fill	n2593
+n3472	.fill	n1385
+n3473	.fill	n3249
+n3474	.fill	n4093
+n3475	.fill	n2527
+n3476	.fill	n1467
+n3477	.fill	n1702
+n3478	.fill	n192
+n3479	.fill	n1008
+n3480	.fill	n346
+n3481	.fill	n3502
+n3482	.fill	n543
+n3483	.fill	n2468
+n3484	.fill	n2952
+n3485	.fill	n3965
+n3486	.fill	n2347
+n3487	.fill	n3997
+n3488	.fill	n3321
+n3489	.fill	n3371
+n3490	.fill	n1643
+n3491	.fill	n1418
+n3492	.fill	n3833
+n3493	.fill	n1962
+n3494	.fill	n851
+n3495	.fill	n3199
+n3496	.fill	n2476
+n3497	.fill	n2371
+n3498	.fill	n1741
+n3499	.fill	n3517
+n3500	.fill	n3692
+n3501	.fill	n441
+n3502	.fill	n1324
+n3503	.fill	n129
+n3504	.fill	n3838
+n3505	.fill	n4036
+n3506	.fill	n1070
+n3507	.fill	n1102
+n3508	.fill	n4071
+n3509	.fill	n59
+n3510	.fill	n3768
+n3511	.fill	n3899
+n3512	.fill	n1100
+n3513	.fill	n564
+n3514	.fill	n3441
+n3515	.fill	n753
+n3516	.fill	n52
+n3517	.fill	n1887
+n3518	.fill	n544
+n3519	.fill	n2569
+n3520	.fill	n4004
+n3521	.fill	n2186
+n3522	.fill	n3005
+n3523	.fill	n1097
+n3524	.fill	n1649
+n3525	.fill	n2811
+n3526	.fill	n1035
+n3527	.fill	n2164
+n3528	.fill	n3474
+n3529	.fill	n3565
+n3530	.fill	n2623
+n3531	.fill	n2973
+n3532	.fill	n1898
+n3533	.fill	n1194
+n3534	.fill	n384
+n3535	.fill	n1822
+n3536	.fill	n875
+n3537	.fill	n659
+n3538	.fill	n2772
+n3539	.fill	n2154
+n3540	.fill	n2784
+n3541	.fill	n1003
+n3542	.fill	n147
+n3543	.fill	n345
+n3544	.fill	n1522
+n3545	.fill	n446
+n3546	.fill	n209
+n3547	.fill	n1585
+n3548	.fill	n173
+n3549	.fill	n1687
+n3550	.fill	n3888
+n3551	.fill	n3665
+n3552	.fill	n2646
+n3553	.fill	n2190
+n3554	.fill	n3582
+n3555	.fill	n3433
+n3556	.fill	n2534
+n3557	.fill	n925
+n3558	.fill	n2088
+n3559	.fill	n3578
+n3560	.fill	n1420
+n3561	.fill	n3632
+n3562	.fill	n2842
+n3563	.fill	n700
+n3564	.fill	n3809
+n3565	.fill	n1902
+n3566	.fill	n3825
+n3567	.fill	n1326
+n3568	.fill	n3579
+n3569	.fill	n2591
+n3570	.fill	n566
+n3571	.fill	n1923
+n3572	.fill	n3028
+n3573	.fill	n3144
+n3574	.fill	n1086
+n3575	.fill	n2778
+n3576	.fill	n1747
+n3577	.fill	n3767
+n3578	.fill	n3923
+n3579	.fill	n1294
+n3580	.fill	n1491
+n3581	.fill	n782
+n3582	.fill	n1714
+n3583	.fill	n2773
+n3584	.fill	n1439
+n3585	.fill	n3512
+n3586	.fill	n1595
+n3587	.fill	n3878
+n3588	.fill	n592
+n3589	.fill	n2971
+n3590	.fill	n4009
+n3591	.fill	n3532
+n3592	.fill	n3336
+n3593	.fill	n3351
+n3594	.fill	n2935
+n3595	.fill	n268
+n3596	.fill	n3821
+n3597	.fill	n635
+n3598	.fill	n842
+n3599	.fill	n1866
+n3600	.fill	n1698
+n3601	.fill	n153
+n3602	.fill	n3303
+n3603	.fill	n1798
+n3604	.fill	n3908
+n3605	.fill	n3343
+n3606	.fill	n323
+n3607	.fill	n1260
+n3608	.fill	n1834
+n3609	.fill	n2008
+n3610	.fill	n3511
+n3611	.fill	n540
+n3612	.fill	n2018
+n3613	.fill	n1401
+n3614	.fill	n2819
+n3615	.fill	n984
+n3616	.fill	n24
+n3617	.fill	n1476
+n3618	.fill	n294
+n3619	.fill	n2835
+n3620	.fill	n3299
+n3621	.fill	n3704
+n3622	.fill	n315
+n3623	.fill	n2373
+n3624	.fill	n443
+n3625	.fill	n1187
+n3626	.fill	n643
+n3627	.fill	n80
+n3628	.fill	n676
+n3629	.fill	n2197
+n3630	.fill	n789
+n3631	.fill	n1807
+n3632	.fill	n393
+n3633	.fill	n2529
+n3634	.fill	n482
+n3635	.fill	n769
+n3636	.fill	n2965
+n3637	.fill	n4082
+n3638	.fill	n2175
+n3639	.fill	n4046
+n3640	.fill	n3911
+n3641	.fill	n2984
+n3642	.fill	n2257
+n3643	.fill	n33
+n3644	.fill	n2209
+n3645	.fill	n1586
+n3646	.fill	n464
+n3647	.fill	n2484
+n3648	.fill	n1305
+n3649	.fill	n2176
+n3650	.fill	n3286
+n3651	.fill	n1458
+n3652	.fill	n2524
+n3653	.fill	n905
+n3654	.fill	n190
+n3655	.fill	n989
+n3656	.fill	n2775
+n3657	.fill	n912
+n3658	.fill	n2382
+n3659	.fill	n1658
+n3660	.fill	n1264
+n3661	.fill	n1328
+n3662	.fill	n955
+n3663	.fill	n3962
+n3664	.fill	n2211
+n3665	.fill	n259
+n3666	.fill	n3409
+n3667	.fill	n170
+n3668	.fill	n2610
+n3669	.fill	n2127
+n3670	.fill	n3020
+n3671	.fill	n2573
+n3672	.fill	n1059
+n3673	.fill	n2285
+n3674	.fill	n2887
+n3675	.fill	n263
+n3676	.fill	n3271
+n3677	.fill	n3432
+n3678	.fill	n992
+n3679	.fill	n2800
+n3680	.fill	n2580
+n3681	.fill	n1573
+n3682	.fill	n2151
+n3683	.fill	n2712
+n3684	.fill	n3527
+n3685	.fill	n3150
+n3686	.fill	n2734
+n3687	.fill	n2071
+n3688	.fill	n3991
+n3689	.fill	n1281
+n3690	.fill	n1907
+n3691	.fill	n784
+n3692	.fill	n4014
+n3693	.fill	n2950
+n3694	.fill	n3188
+n3695	.fill	n1636
+n3696	.fill	n2705
+n3697	.fill	n2677
+n3698	.fill	n1047
+n3699	.fill	n2704
+n3700	.fill	n1512
+n3701	.fill	n1256
+n3702	.fill	n1534
+n3703	.fill	n1473
+n3704	.fill	n3297
+n3705	.fill	n3016
+n3706	.fill	n3370
+n3707	.fill	n3779
+n3708	.fill	n440
+n3709	.fill	n2286
+n3710	.fill	n357
+n3711	.fill	n3311
+n3712	.fill	n2691
+n3713	.fill	n488
+n3714	.fill	n338
+n3715	.fill	n31
+n3716	.fill	n1444
+n3717	.fill	n1254
+n3718	.fill	n1274
+n3719	.fill	n3056
+n3720	.fill	n427
+n3721	.fill	n773
+n3722	.fill	n1446
+n3723	.fill	n312
+n3724	.fill	n1663
+n3725	.fill	n2929
+n3726	.fill	n1156
+n3727	.fill	n3268
+n3728	.fill	n1906
+n3729	.fill	n2713
+n3730	.fill	n3204
+n3731	.fill	n1677
+n3732	.fill	n2537
+n3733	.fill	n2423
+n3734	.fill	n555
+n3735	.fill	n495
+n3736	.fill	n2421
+n3737	.fill	n2621
+n3738	.fill	n1667
+n3739	.fill	n3201
+n3740	.fill	n794
+n3741	.fill	n931
+n3742	.fill	n2356
+n3743	.fill	n1113
+n3744	.fill	n1445
+n3745	.fill	n3223
+n3746	.fill	n1711
+n3747	.fill	n2714
+n3748	.fill	n1115
+n3749	.fill	n165
+n3750	.fill	n10
+n3751	.fill	n3013
+n3752	.fill	n2716
+n3753	.fill	n3804
+n3754	.fill	n1054
+n3755	.fill	n1552
+n3756	.fill	n459
+n3757	.fill	n1641
+n3758	.fill	n360
+n3759	.fill	n1779
+n3760	.fill	n3602
+n3761	.fill	n844
+n3762	.fill	n1856
+n3763	.fill	n3035
+n3764	.fill	n1955
+n3765	.fill	n2290
+n3766	.fill	n1505
+n3767	.fill	n1085
+n3768	.fill	n2369
+n3769	.fill	n772
+n3770	.fill	n1846
+n3771	.fill	n1740
+n3772	.fill	n2654
+n3773	.fill	n1749
+n3774	.fill	n2105
+n3775	.fill	n2306
+n3776	.fill	n2384
+n3777	.fill	n4027
+n3778	.fill	n1927
+n3779	.fill	n4066
+n3780	.fill	n1748
+n3781	.fill	n743
+n3782	.fill	n3590
+n3783	.fill	n229
+n3784	.fill	n894
+n3785	.fill	n3218
+n3786	.fill	n1293
+n3787	.fill	n3930
+n3788	.fill	n754
+n3789	.fill	n2901
+n3790	.fill	n2890
+n3791	.fill	n3399
+n3792	.fill	n232
+n3793	.fill	n1354
+n3794	.fill	n3671
+n3795	.fill	n195
+n3796	.fill	n523
+n3797	.fill	n997
+n3798	.fill	n3646
+n3799	.fill	n1288
+n3800	.fill	n3660
+n3801	.fill	n2526
+n3802	.fill	n4070
+n3803	.fill	n3127
+n3804	.fill	n3773
+n3805	.fill	n586
+n3806	.fill	n3666
+n3807	.fill	n2478
+n3808	.fill	n1351
+n3809	.fill	n1189
+n3810	.fill	n3198
+n3811	.fill	n2479
+n3812	.fill	n1016
+n3813	.fill	n2810
+n3814	.fill	n27
+n3815	.fill	n684
+n3816	.fill	n1824
+n3817	.fill	n1276
+n3818	.fill	n3492
+n3819	.fill	n2736
+n3820	.fill	n2094
+n3821	.fill	n2884
+n3822	.fill	n370
+n3823	.fill	n3493
+n3824	.fill	n2587
+n3825	.fill	n2159
+n3826	.fill	n3853
+n3827	.fill	n2860
+n3828	.fill	n1659
+n3829	.fill	n2659
+n3830	.fill	n1311
+n3831	.fill	n2978
+n3832	.fill	n2739
+n3833	.fill	n3544
+n3834	.fill	n2517
+n3835	.fill	n1744
+n3836	.fill	n2867
+n3837	.fill	n3624
+n3838	.fill	n702
+n3839	.fill	n3443
+n3840	.fill	n3538
+n3841	.fill	n2368
+n3842	.fill	n2989
+n3843	.fill	n3376
+n3844	.fill	n948
+n3845	.fill	n3946
+n3846	.fill	n347
+n3847	.fill	n2213
+n3848	.fill	n3994
+n3849	.fill	n2272
+n3850	.fill	n3600
+n3851	.fill	n1106
+n3852	.fill	n3781
+n3853	.fill	n2753
+n3854	.fill	n2911
+n3855	.fill	n2930
+n3856	.fill	n1965
+n3857	.fill	n261
+n3858	.fill	n349
+n3859	.fill	n1956
+n3860	.fill	n2693
+n3861	.fill	n2027
+n3862	.fill	n3794
+n3863	.fill	n708
+n3864	.fill	n660
+n3865	.fill	n390
+n3866	.fill	n1103
+n3867	.fill	n4017
+n3868	.fill	n1813
+n3869	.fill	n980
+n3870	.fill	n3365
+n3871	.fill	n3541
+n3872	.fill	n82
+n3873	.fill	n3813
+n3874	.fill	n2333
+n3875	.fill	n3414
+n3876	.fill	n787
+n3877	.fill	n579
+n3878	.fill	n524
+n3879	.fill	n914
+n3880	.fill	n1044
+n3881	.fill	n2148
+n3882	.fill	n3545
+n3883	.fill	n3325
+n3884	.fill	n3034
+n3885	.fill	n1110
+n3886	.fill	n946
+n3887	.fill	n3746
+n3888	.fill	n183
+n3889	.fill	n1291
+n3890	.fill	n3784
+n3891	.fill	n2346
+n3892	.fill	n1335
+n3893	.fill	n865
+n3894	.fill	n356
+n3895	.fill	n611
+n3896	.fill	n135
+n3897	.fill	n3719
+n3898	.fill	n2483
+n3899	.fill	n2766
+n3900	.fill	n2033
+n3901	.fill	n3679
+n3902	.fill	n2006
+n3903	.fill	n1192
+n3904	.fill	n2402
+n3905	.fill	n98
+n3906	.fill	n3970
+n3907	.fill	n3979
+n3908	.fill	n1165
+n3909	.fill	n1057
+n3910	.fill	n1240
+n3911	.fill	n1787
+n3912	.fill	n1005
+n3913	.fill	n2865
+n3914	.fill	n739
+n3915	.fill	n1843
+n3916	.fill	n505
+n3917	.fill	n1621
+n3918	.fill	n3182
+n3919	.fill	n1973
+n3920	.fill	n3248
+n3921	.fill	n3963
+n3922	.fill	n252
+n3923	.fill	n3452
+n3924	.fill	n1479
+n3925	.fill	n2123
+n3926	.fill	n608
+n3927	.fill	n2225
+n3928	.fill	n651
+n3929	.fill	n3082
+n3930	.fill	n1613
+n3931	.fill	n909
+n3932	.fill	n2135
+n3933	.fill	n722
+n3934	.fill	n204
+n3935	.fill	n2518
+n3936	.fill	n744
+n3937	.fill	n3450
+n3938	.fill	n3843
+n3939	.fill	n1858
+n3940	.fill	n3623
+n3941	.fill	n4051
+n3942	.fill	n1348
+n3943	.fill	n1212
+n3944	.fill	n3765
+n3945	.fill	n900
+n3946	.fill	n1296
+n3947	.fill	n1483
+n3948	.fill	n3436
+n3949	.fill	n2044
+n3950	.fill	n2699
+n3951	.fill	n1443
+n3952	.fill	n1221
+n3953	.fill	n3594
+n3954	.fill	n1632
+n3955	.fill	n178
+n3956	.fill	n3775
+n3957	.fill	n3224
+n3958	.fill	n1319
+n3959	.fill	n817
+n3960	.fill	n756
+n3961	.fill	n2081
+n3962	.fill	n998
+n3963	.fill	n1246
+n3964	.fill	n4057
+n3965	.fill	n2051
+n3966	.fill	n2923
+n3967	.fill	n1590
+n3968	.fill	n2508
+n3969	.fill	n7
+n3970	.fill	n2841
+n3971	.fill	n1345
+n3972	.fill	n521
+n3973	.fill	n509
+n3974	.fill	n1399
+n3975	.fill	n2449
+n3976	.fill	n1314
+n3977	.fill	n2519
+n3978	.fill	n2149
+n3979	.fill	n518
+n3980	.fill	n1363
+n3981	.fill	n1706
+n3982	.fill	n1729
+n3983	.fill	n145
+n3984	.fill	n847
+n3985	.fill	n3212
+n3986	.fill	n386
+n3987	.fill	n897
+n3988	.fill	n1839
+n3989	.fill	n3295
+n3990	.fill	n3757
+n3991	.fill	n3410
+n3992	.fill	n568
+n3993	.fill	n2150
+n3994	.fill	n1081
+n3995	.fill	n1204
+n3996	.fill	n101
+n3997	.fill	n162
+n3998	.fill	n2708
+n3999	.fill	n63
+n4000	.fill	n1415
+n4001	.fill	n3244
+n4002	.fill	n362
+n4003	.fill	n1369
+n4004	.fill	n1196
+n4005	.fill	n3464
+n4006	.fill	n2845
+n4007	.fill	n3844
+n4008	.fill	n3287
+n4009	.fill	n2304
+n4010	.fill	n2016
+n4011	.fill	n624
+n4012	.fill	n3712
+n4013	.fill	n291
+n4014	.fill	n4016
+n4015	.fill	n1279
+n4016	.fill	n433
+n4017	.fill	n50
+n4018	.fill	n265
+n4019	.fill	n2760
+n4020	.fill	n1159
+n4021	.fill	n1556
+n4022	.fill	n3609
+n4023	.fill	n332
+n4024	.fill	n1572
+n4025	.fill	n394
+n4026	.fill	n798
+n4027	.fill	n241
+n4028	.fill	n1932
+n4029	.fill	n4061
+n4030	.fill	n2703
+n4031	.fill	n66
+n4032	.fill	n615
+n4033	.fill	n3988
+n4034	.fill	n1462
+n4035	.fill	n3057
+n4036	.fill	n717
+n4037	.fill	n735
+n4038	.fill	n1616
+n4039	.fill	n2616
+n4040	.fill	n4081
+n4041	.fill	n2575
+n4042	.fill	n2981
+n4043	.fill	n1660
+n4044	.fill	n2730
+n4045	.fill	n4019
+n4046	.fill	n2638
+n4047	.fill	n1685
+n4048	.fill	n336
+n4049	.fill	n2501
+n4050	.fill	n3799
+n4051	.fill	n1959
+n4052	.fill	n3954
+n4053	.fill	n3605
+n4054	.fill	n2511
+n4055	.fill	n1232
+n4056	.fill	n594
+n4057	.fill	n1009
+n4058	.fill	n2429
+n4059	.fill	n1981
+n4060	.fill	n3816
+n4061	.fill	n803
+n4062	.fill	n1417
+n4063	.fill	n3922
+n4064	.fill	n640
+n4065	.fill	n3705
+n4066	.fill	n974
+n4067	.fill	n2634
+n4068	.fill	n2536
+n4069	.fill	n1202
+n4070	.fill	n3669
+n4071	.fill	n2878
+n4072	.fill	n2763
+n4073	.fill	n2370
+n4074	.fill	n3745
+n4075	.fill	n2221
+n4076	.fill	n3817
+n4077	.fill	n1095
+n4078	.fill	n3064
+n4079	.fill	n1242
+n4080	.fill	n425
+n4081	.fill	n2510
+n4082	.fill	n1796
+n4083	.fill	n2121
+n4084	.fill	n1233
+n4085	.fill	n1136
+n4086	.fill	n1847
+n4087	.fill	n1023
+n4088	.fill	n269
+n4089	.fill	n3978
+n4090	.fill	n1427
+n4091	.fill	n3552
+n4092	.fill	n1553
+n4093	.fill	n2298
+n4094	.fill	n1886
+n4095	.fill	n1404
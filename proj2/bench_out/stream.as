@@ -0,0 +1,20 @@
+        lw      0 6 neg1
+        lw      0 7 one
+        lw      0 5 reps
+outer   beq     0 5 done
+        lw      0 1 size
+        lw      0 2 base
+inner   beq     0 1 next
+        lw      2 3 0
+        add     4 3 4
+        add     2 7 2
+        add     1 6 1
+        beq     0 0 inner
+next    add     5 6 5
+        beq     0 0 outer
+done    halt
+neg1    .fill   -1
+one     .fill   1
+reps    .fill   20
+size    .fill   16384
+base    .fill   32768
@@ -0,0 +1,36 @@
+#!/bin/bash
+
+# Run every program in test-suite/ on the single core loop, with -c 2 and
+# against itself with -P, and check that each run ends with the same exit
+# status. The file names give the cache,
+# program.as.blockSize.numberOfSets.blocksPerSet.
+# Run from proj2/ after building the simulator and the assembler.
+
+out=${TMPDIR:-/tmp}/check.$$
+fail=0
+
+for f in test-suite/*.as.*; do
+    name=${f##*/}
+    geometry=$(echo ${name#*.as.} | tr . ' ')
+    if ! ./assembler $f $out.mc > /dev/null; then
+        echo "$name: doesn't assemble, skipped"
+        continue
+    fi
+
+    ./simulator $out.mc $geometry -q > /dev/null 2>&1
+    single=$?
+    ./simulator $out.mc $geometry -q -c 2 > /dev/null 2>&1
+    cores=$?
+    ./simulator $out.mc $geometry -q -P $out.mc > /dev/null 2>&1
+    programs=$?
+
+    if [ $single != $cores ] || [ $single != $programs ]; then
+        echo "$name: exit $single, $cores with -c 2, $programs with -P"
+        fail=1
+    else
+        echo "$name: ok (exit $single)"
+    fi
+done
+
+rm -f $out.mc
+exit $fail
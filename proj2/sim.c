@@ -5,19 +5,23 @@
 #include <string.h>
 #include <math.h>
 #include <limits.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/mman.h>
 
-#define NUMMEMORY 32 /* maximum number of words in memory */
+#define NUMMEMORY 65536 /* default number of words in memory */
 #define NUMREGS 8 /* number of machine registers */
 #define MAXLINELENGTH 1000
+#define PAGESHIFT 12 /* memory is allocated in pages of 4096 words */
+#define PAGESIZE (1 << PAGESHIFT)
+#define MAXSECTORS 32 /* sectors per block, one bit each in sec_valid */
 
-/* A mask with x least-significant bits set, possibly 0 or >=32 */
-#define BIT_MASK(x) (((x) >= sizeof(unsigned) * CHAR_BIT) ? (unsigned) -1 : (1U << (x)) - 1)
-#define log2(n) ( log(n) / log(2) )
-
-int TIMESTAMP;
+__thread long long TIMESTAMP; /* per thread, for the multicore mode */
 
 enum { add, nand, lw, sw, beq, cmov, halt, noop };
-enum { fetch, store };
+enum { fetch, store, load }; /* cache access types */
 enum { false, true };
 enum actionType
         {cacheToProcessor, processorToCache, memoryToCache, cacheToMemory,
@@ -27,227 +31,4579 @@ typedef struct cache_line_struct {
   int tag;
   int valid;
   int dirty;
-  int lru;
-  int access_timestamp;
+  unsigned sec_valid; /* one bit per sector */
+  unsigned sec_dirty;
+  int coh; /* coherence state, multicore mode only */
+  int snooped; /* invalidated by another core, the tag is kept */
+  int owner; /* program that brought the block in */
+  long long access_timestamp;
   int mem_head;
+  int csize; /* words the block takes compressed, with -z */
+  int changed; /* listed for the next -D dump */
   int *lines;
 } cache_block;
 
-typedef struct cache_set_struct {
-  cache_block *blocks;
-} cache_set;
+typedef struct cache_set_struct {
+  cache_block *blocks;
+} cache_set;
+
+typedef struct stateStruct stateType;
+typedef int (*cacheKernel)(int, int, int, stateType *);
+
+struct stateStruct {
+  int pc;
+  int **pages; /* sparse memory, a page is allocated on first write */
+  int numPages;
+  int memSize;
+  int reg[NUMREGS];
+  int numMemory;
+
+  cache_set *CACHE;
+  int b_size;
+  int n_sets;
+  int bps;
+  int off_bits; /* address split, for power of two geometries */
+  int set_bits;
+  int set_mask;
+  int sec_size; /* words per sector, b_size if the cache isn't sectored */
+  int sec_bits;
+  unsigned sec_all; /* sec_valid with every sector present */
+  cacheKernel kernel; /* chosen by selectKernel */
+};
+
+/*
+ * Performance counters, written out as JSON when the simulator exits.
+ * Cache counters are indexed by access type.
+ */
+typedef struct statsStruct {
+  long long instrs;
+  long long opcodes[8];
+  long long beq_taken;
+  long long beq_not_taken;
+  long long loads;
+  long long stores;
+  long long hits[3];
+  long long misses[3];
+  long long evictions;
+  long long writebacks;
+  long long sector_misses; /* misses on a resident block, counted in misses */
+  long long mem_reads; /* words moved from memory into the cache */
+  long long mem_writes; /* words written back to memory */
+  long long *set_conflicts; /* misses that had to evict, per set */
+} statsType;
+
+__thread statsType STATS;
+
+FILE *STATS_OUT; /* stats file until "final" is written, for statsAbort */
+
+int QUIET; /* don't log cache actions */
+
+/*
+ * Optional five-stage pipeline timing model. Instructions still execute
+ * atomically in main, pipeStep then works out when each one enters each
+ * stage of an in-order IF/ID/EX/MEM/WB pipeline in which an instruction
+ * can't move into a stage until the one ahead of it has left.
+ */
+enum { IF, ID, EX, MEM, WB, NUMSTAGES };
+enum { stall_icache, stall_dcache, stall_load_use, stall_raw, stall_branch,
+       stall_structural, NUMSTALLS };
+
+typedef struct pipeStruct {
+  int enabled;
+  int forwarding;
+  int resolve_stage; /* stage at the end of which beq is resolved */
+  int flush_penalty; /* extra cycles to squash wrong-path instructions */
+  int miss_penalty; /* extra cycles for a cache miss in IF or MEM */
+
+  long long ent[NUMSTAGES]; /* previous instruction's stage entry cycles */
+  long long redirect; /* earliest fetch after a mispredicted beq */
+  long long ready[NUMREGS]; /* first cycle each register can be forwarded */
+  int from_load[NUMREGS]; /* register was last written by lw */
+
+  long long instrs;
+  long long cycles;
+  long long flushes;
+  long long stalls[NUMSTALLS];
+} pipeType;
+
+pipeType PIPE;
+
+/*
+ * Optional DRAM timing behind the cache, with -d. The data still lives in
+ * state->mem, this only works out when each transfer finishes. Memory is
+ * split into row sized chunks dealt out to channels, then banks, then
+ * rows, so a stream runs along an open row before moving on. The clock
+ * ticks once per cache access and stops while a fill is waited for;
+ * fills are the only transfers that hold the processor up. Writebacks
+ * wait in a write queue which, once full, is drained down to half,
+ * open row hits first and then oldest first (FR-FCFS). Every tREFI
+ * cycles all banks are closed and busy for tRFC.
+ */
+#define DRAMQUEUE 64
+
+typedef struct dramBankStruct {
+  int row; /* open row, -1 if precharged */
+  long long ready; /* cycle the bank can take its next access */
+} dramBank;
+
+typedef struct dramStruct {
+  int enabled;
+  int channels;
+  int banks; /* per channel */
+  int row_words;
+  int closed_page; /* precharge after every access */
+  int tCAS;
+  int tRCD;
+  int tRP;
+  int tBurst; /* data bus cycles per word */
+  int tREFI; /* cycles between refreshes, 0 for none */
+  int tRFC;
+  int depth; /* write queue entries */
+
+  dramBank *bank; /* channels * banks */
+  long long *bus; /* cycle each channel's data bus is free */
+  long long now;
+  long long next_refresh;
+  int queue[DRAMQUEUE]; /* queued writebacks, oldest first */
+  int queue_words[DRAMQUEUE];
+  int queued;
+
+  long long reads;
+  long long writes;
+  long long forwarded; /* fills found in the write queue */
+  long long row_hits;
+  long long row_empty;
+  long long row_conflicts;
+  long long refreshes;
+  long long drains;
+  long long stall; /* cycles the processor waited on fills */
+} dramType;
+
+dramType DRAM;
+
+/*
+ * Optional paging in front of the cache, with -v. Program addresses are
+ * virtual, and a page table of VM.levels levels in simulated memory maps
+ * every page to a frame. A table entry holds the physical address of the
+ * next table, or of the frame, plus one, so 0 is unmapped. Each cache
+ * access is translated through an L1 then an L2 TLB, and a miss in both
+ * has the walker read one entry per level through the data cache.
+ *
+ * With a PIPT cache every access waits for the L1 TLB; a VIPT cache
+ * looks the L1 TLB up while it indexes, so only TLB misses cost cycles,
+ * but it has to be indexed within the page offset. -vh maps everything
+ * with huge pages, one level above the leaves.
+ */
+#define TLBMAX 4096
+
+enum { tlb_lru, tlb_fifo, tlb_random };
+
+typedef struct tlbEntryStruct {
+  int vpn; /* -1 if empty */
+  int frame; /* physical address of the page */
+  long long used;
+  long long filled;
+} tlbEntry;
+
+typedef struct tlbStruct {
+  int entries;
+  int ways;
+  int latency;
+  tlbEntry *entry;
+  long long hits;
+  long long misses;
+} tlbType;
+
+typedef struct vmStruct {
+  int enabled;
+  int page_words;
+  int levels;
+  int huge;
+  int vipt;
+  int random_frames;
+  int policy;
+  unsigned seed;
+
+  int size; /* words of virtual memory */
+  int unit_bits; /* log2 of the words a leaf entry maps */
+  int index_bits; /* log2 of the entries in a table */
+  int walk_levels; /* levels read by a walk */
+  int root; /* physical address of the top table */
+  int walking; /* the walker's accesses are already physical */
+  long long clock;
+
+  tlbType l1;
+  tlbType l2;
+
+  long long walks;
+  long long walk_accesses;
+  long long walk_misses;
+  long long walk_dram; /* DRAM stall cycles of walk accesses */
+  long long walk_cycles;
+  long long stall; /* cycles spent translating */
+} vmType;
+
+vmType VM;
+
+/*
+ * Branch prediction for beq. Every beq is run past the selected predictor
+ * and a BTB, a predicted taken beq only redirects fetch if the BTB holds
+ * its target.
+ */
+enum { bp_nt, bp_btfn, bp_bimodal, bp_gshare, bp_tournament, bp_tage,
+       NUMPREDICTORS };
+
+#define BPTABLEBITS 12 /* 4096 entry counter tables */
+#define BTBENTRIES 512
+#define TAGETABLES 4
+#define TAGEBITS 10 /* entries per tagged TAGE table */
+
+typedef struct tageEntryStruct {
+  unsigned short tag;
+  signed char ctr; /* taken if >= 0 */
+  unsigned char useful;
+} tageEntry;
+
+typedef struct predictorStruct {
+  int kind;
+  int penalty; /* cycles lost per mispredict when not pipelined */
+  unsigned int history; /* global history, newest outcome in bit 0 */
+  unsigned char *bimodal; /* 2-bit counters, taken if >= 2 */
+  unsigned char *gshare;
+  unsigned char *chooser; /* tournament, >= 2 picks gshare */
+  tageEntry *tage[TAGETABLES];
+  int btb_pc[BTBENTRIES];
+  int btb_target[BTBENTRIES];
+
+  long long branches;
+  long long mispredicts;
+  long long btb_misses;
+} predictorType;
+
+predictorType BP;
+
+static const char *bp_names[NUMPREDICTORS] =
+    { "nt", "btfn", "bimodal", "gshare", "tournament", "tage" };
+static const int tage_history[TAGETABLES] = { 4, 8, 16, 32 };
+
+/*
+ * Multicore mode. Each core has its own pc, registers and private cache,
+ * all of them sharing memory, and the caches are kept coherent by
+ * snooping with MESI or MOESI.
+ *
+ * Host threads run the cores in quanta of MULTI.quantum instructions.
+ * Within a quantum a core runs in parallel with the others for as long as
+ * it only touches its own cache: loads that hit and stores to blocks it
+ * holds in M or E. At the first access that needs the bus the core stops,
+ * and once every core has stopped the main thread runs the rest of each
+ * stopped core's quantum, one core at a time in core order, with bus
+ * transactions and snoops allowed. Nothing a core sees in the parallel
+ * part can be changed by another core until the serial part, so a run
+ * only depends on the quantum, not on the number of threads or how they
+ * were scheduled.
+ */
+enum { coh_I, coh_S, coh_E, coh_O, coh_M }; /* block coherence states */
+enum { bus_rd, bus_rdx, bus_upgr }; /* snooped bus transactions */
+
+typedef struct coreStruct {
+  stateType state; /* pages are shared with every other core */
+  statsType stats;
+  long long timestamp;
+  int halted;
+  int stalled; /* stopped for the bus in the parallel part */
+  int budget; /* instructions left in this quantum */
+  int fetched; /* instr was fetched before the core stalled */
+  int instr;
+
+  long long bus[3]; /* transactions issued, by type */
+  long long invalidations; /* blocks of this cache invalidated by snoops */
+  long long coherence_misses; /* misses on a block lost to an invalidation */
+  long long supplies; /* blocks sent to another cache */
+  long long flushes; /* dirty blocks written to memory by a snoop */
+} coreType;
+
+typedef struct multiStruct {
+  int cores; /* 1 for the normal single core simulator */
+  int moesi;
+  int quantum;
+  int threads;
+  coreType *core;
+
+  long long quanta;
+  int finished;
+  pthread_barrier_t start;
+  pthread_barrier_t done;
+} multiType;
+
+multiType MULTI;
+
+/*
+ * Multi-program mode. Several programs, each with its own MP.mem word
+ * address space, take turns on one processor and share its cache. The
+ * cache sees a program's addresses offset by the program's base, so
+ * their blocks never alias.
+ *
+ * The cache can be way partitioned between the programs. A program that
+ * holds fewer blocks of a set than its quota evicts the lru block of
+ * another program, otherwise its own lru block. With UCP the quotas are
+ * recomputed every MP.interval accesses from utility monitors: for a
+ * sample of the sets, each program keeps an lru stack of shadow tags as
+ * if it had the whole cache, and counts hits at each stack position.
+ */
+enum { sched_rr, sched_random, sched_miss };
+
+typedef struct progStruct {
+  char *name;
+  int base;
+  int pc;
+  int reg[NUMREGS];
+  int halted;
+  statsType stats;
+  long long evicted_others; /* blocks of other programs this one evicted */
+  long long evicted_by_others;
+} progType;
+
+typedef struct multiProgStruct {
+  int count; /* 1 for the normal single program simulator */
+  int mem; /* words of memory per program */
+  int schedule;
+  int slice; /* instructions per turn */
+  unsigned seed; /* for sched_random */
+  progType *prog;
+
+  int *quota; /* ways per set for each program, NULL if not partitioned */
+  int ucp;
+  int interval; /* cache accesses between UCP repartitions */
+  int stride; /* the monitors watch every stride-th set */
+  int sampled; /* number of sets watched */
+  int ways;
+  int *atd; /* shadow tag stacks, by program, sampled set and position */
+  long long *way_hits; /* monitor hits by program and stack position */
+  long long accesses;
+  long long repartitions;
+} multiProgType;
+
+multiProgType MP;
+int OWNER; /* program making the current cache access */
+
+/*
+ * Per-pc profile, kept with -prof or -fold. Addresses are mapped back to
+ * the source with the symbol table the assembler writes with -g, one
+ * "address line [label]" line per word.
+ */
+enum { fold_instrs, fold_misses, fold_stalls };
+
+typedef struct profEntryStruct {
+  long long execs;
+  long long imisses;
+  long long dmisses;
+  long long mispredicts;
+  long long stalls;
+} profEntry;
+
+typedef struct profileStruct {
+  int size; /* words profiled, from address 0 */
+  profEntry *pc; /* NULL if not profiling */
+  int *line; /* source line of each word, 0 if unknown */
+  char **label;
+  int *leader; /* word starts a basic block */
+  char *name; /* program, the root frame of folded stacks */
+} profileType;
+
+profileType PROF;
+
+/*
+ * Reuse distance analysis, with -rd. The reuse distance of an access is
+ * the number of distinct blocks touched since the last access to the
+ * same block, so a fully associative lru cache of more than that many
+ * blocks hits. Distances are found with a Fenwick tree over access times
+ * holding a 1 at the last access time of every block: the distance is
+ * the count between the block's last time and now. When the times run
+ * out the live ones are renumbered in order, so the tree only needs to
+ * be twice the number of blocks and each access is O(log n).
+ *
+ * Histograms have a bucket for distance 0 and then one per power of two.
+ */
+#define RDBUCKETS 33
+
+typedef struct reuseStruct {
+  int blocks; /* blocks of memory, NULL last if not analysing */
+  int cap; /* access times before renumbering */
+  int now;
+  int *last; /* last access time of each block, 0 if never */
+  int *owner; /* block last accessed at each time */
+  int *tree; /* Fenwick tree over times 1..cap */
+
+  int pc; /* pc of the instruction making the access, -1 if unknown */
+  int pcs; /* words of program with per pc histograms */
+  long long hist[3][RDBUCKETS];
+  long long cold[3];
+  long long *pc_hist; /* RDBUCKETS + 1 per pc, the last is cold */
+  long long *heat; /* accesses to each block, by type */
+} reuseType;
+
+reuseType RD;
+
+/*
+ * Belady's MIN, with -opt. The block and type of every cache access are
+ * kept, and at the end the same geometry is run again evicting the block
+ * whose next use is furthest away. Next uses come from one backward pass
+ * over the accesses, and each set is a max-heap on next use, so the run
+ * is O(n log ways). Like the real cache, MIN always allocates.
+ */
+typedef struct minStruct {
+  int *block; /* block of each access, NULL if not enabled */
+  unsigned char *type;
+  int n;
+  int size;
+  long long misses[3];
+} minType;
+
+minType MIN;
+
+/*
+ * Energy and area estimate, with -e, worked out from the counters at the
+ * end of the run. The tag and data arrays have a row per set, and every
+ * access to an array drives a whole row: a lookup reads the tags of all
+ * ways, and a read, a write, a sector fill or a sector writeback drives
+ * the data row. Driving a bit costs more the more rows hang off its
+ * bitline, growing with the square root of the rows from
+ * ENERGY.bit_read at 64. Every bit leaks for every cycle, and each DRAM
+ * transfer costs an activation, unless -d found its row open, plus a
+ * cost per word. Cycles are the pipeline's with -p, otherwise one per
+ * instruction plus the miss and mispredict penalties.
+ */
+typedef struct energyStruct {
+  int enabled;
+  double ghz;
+  double bit_read; /* pJ to drive a bit of a 64 row array */
+  double bit_leak; /* pW per bit */
+  double dram_act; /* pJ per row activation */
+  double dram_word; /* pJ per word moved */
+  double bit_area; /* um^2 per bit, periphery included */
+
+  int tag_bits; /* per block, with valid, dirty, sector and lru bits */
+  long long bits; /* tag and data bits of the whole cache */
+  double area; /* mm^2 */
+  long long cycles;
+  double tag; /* pJ */
+  double data;
+  double leak;
+  double dram;
+} energyType;
+
+energyType ENERGY;
+
+/*
+ * Compressed cache, with -z factor. Each set has factor times as many
+ * tags as its blocksPerSet, but still only blocksPerSet * blockSize words
+ * of data, and each block takes the words its contents compress to, so
+ * how many blocks fit depends on the values in them. Whenever a block is
+ * filled or written its size is worked out again, and the set's least
+ * recently used other blocks are evicted until everything fits.
+ *
+ * A block is stored in the smallest of:
+ *
+ *     zero: every word 0, 1 byte
+ *     repeat: every word the same, 4 bytes
+ *     base-delta-immediate (BDI), 1 or 2 byte deltas: a 4 byte base and
+ *         a delta per word from either the base or 0, plus a bit per
+ *         word saying which
+ *     frequent value (FVC): a 3 bit code per word, naming one of the
+ *         values in zip_values or saying the 4 byte word follows
+ *     raw: 4 bytes a word
+ *
+ * rounded up to whole words. An uncompressed LRU cache of the same data
+ * capacity runs alongside on tags alone, for the hit rate gain.
+ */
+enum { zip_zero, zip_repeat, zip_bdi1, zip_bdi2, zip_fvc, zip_raw, NUMZIPS };
+
+typedef struct zipStruct {
+  int factor; /* 0 if off */
+  int ways; /* blocks of data per set */
+  int capacity; /* words of data per set */
+
+  int *shadow; /* uncompressed cache, block + 1 per way, 0 if empty */
+  long long *shadow_time;
+  long long shadow_hits;
+  long long shadow_misses;
+
+  long long packs; /* times a block's size was worked out */
+  long long raw_words;
+  long long packed_words;
+  long long schemes[NUMZIPS];
+  long long evictions; /* blocks evicted for space, not for a tag */
+  double occupancy; /* resident blocks per way at the end */
+} zipType;
+
+zipType ZIP;
+
+static const int zip_values[7] = { 0, 1, -1, 2, 3, 4, 8 };
+
+/*
+ * Reference stream trace files.
+ *
+ * Binary traces start with TRACEMAGIC and are a sequence of chunks, each
+ * a 4-byte raw length, a 4-byte stored length and the chunk data, which
+ * is LZ compressed unless both lengths are equal. Uncompressed, a chunk
+ * holds one record per cache access: a byte holding the access type, the
+ * address as a zigzag varint delta from the previous address of the same
+ * type and, for stores only, the stored value as a zigzag varint. Address
+ * deltas restart at 0 in every chunk.
+ *
+ * When replaying, a reader thread decompresses up to NUMCHUNKBUFS chunks
+ * ahead of the replay loop, so memory use doesn't depend on trace length.
+ *
+ * Text traces have one access per line, "f addr", "l addr" or
+ * "s addr value", and lines starting with # are ignored.
+ */
+#define TRACEMAGIC "LCT2"
+#define CHUNKSIZE 65536 /* uncompressed bytes per chunk */
+#define ZCHUNKSIZE (CHUNKSIZE + CHUNKSIZE / 255 + 16) /* worst case LZ output */
+#define MAXRECORD 11 /* type byte and two 5 byte varints */
+#define NUMCHUNKBUFS 4
+#define LZHASHBITS 12
+
+typedef struct chunkStruct {
+  unsigned char data[CHUNKSIZE];
+  int len; /* 0 marks the end of the trace */
+} chunkType;
+
+typedef struct traceStruct {
+  FILE *file;
+  int binary;
+  int last_addr[3]; /* previous address of each access type */
+
+  /* chunk being filled (recording) or consumed (replay) */
+  unsigned char *buf;
+  int pos;
+  int len;
+  unsigned char *zbuf;
+
+  /* ring of decompressed chunks filled by the reader thread */
+  chunkType *ring;
+  int head; /* chunk the replay loop is consuming */
+  int count; /* chunks in the ring, including the one at head */
+  pthread_t reader;
+  pthread_mutex_t lock;
+  pthread_cond_t filled;
+  pthread_cond_t drained;
+} traceType;
+
+traceType TRACE_OUT; /* stream being recorded, file is NULL if off */
+
+/*
+ * Live counters for simtop, with -live file. The file is mapped shared
+ * and rewritten every LIVEINTERVAL cache accesses under a sequence lock:
+ * seq is odd while an update is being written, and a reader retries if it
+ * saw it odd or saw it change. Nothing blocks and nothing is written out
+ * by the simulator, the kernel keeps the page. The layout is shared with
+ * proj1's simulator and simtop.
+ */
+#define LIVEMAGIC 0x4c495645
+#define LIVEINTERVAL 65536
+
+typedef struct liveSharedStruct {
+  unsigned magic;
+  unsigned seq;
+  int pid;
+  int done; /* the simulator finished */
+  int pc;
+  int cache; /* the counters below mean something */
+  long long instrs;
+  long long accesses;
+  long long hits;
+  long long misses;
+  long long start_ns;
+  long long now_ns;
+  char sim[16];
+  char name[64];
+} liveShared;
+
+typedef struct liveStruct {
+  liveShared *shm; /* NULL if off */
+  long long left; /* accesses until the next update, LLONG_MAX if off */
+} liveType;
+
+liveType LIVE;
+
+/*
+ * Incremental state dumps, with -D file. The first dump is the whole
+ * machine and every later one holds only what changed since the one
+ * before, one JSON object per line. Memory writes mark their DUMPCHUNK
+ * word chunk and cache updates their block, each goes on a list the
+ * first time, so a dump costs what changed rather than the size of
+ * memory and the cache. A marked chunk is compared against a copy of
+ * memory as of the last dump, so a word written back with the value it
+ * had isn't reported. Registers are just compared.
+ */
+#define DUMPCHUNKBITS 6
+#define DUMPCHUNK (1 << DUMPCHUNKBITS)
+
+typedef struct dumpStruct {
+  FILE *file; /* NULL if off */
+  int interval; /* instructions between dumps */
+  long long dumps;
+  int reg[NUMREGS]; /* as of the last dump */
+  int **shadow; /* memory pages as of the last dump, NULL if all 0 */
+  unsigned char *written; /* per chunk, written since the last dump */
+  int *chunks; /* chunks marked in written */
+  int n_chunks;
+  cache_block **blocks; /* cache blocks changed since the last dump */
+  int n_blocks;
+} dumpType;
+
+dumpType DUMP;
+
+void initMemory(stateType *, int);
+int memRead(stateType *, int);
+void memWrite(stateType *, int, int);
+void copyState(stateType *, stateType *);
+void freeState(stateType *);
+int kick_lru(int, int, stateType *);
+void splitAddr(stateType *, int, int *, int *, int *);
+void tracePut(traceType *, int, int, int);
+cache_block *findBlock(stateType *, int, int);
+int convertNum(int);
+void umonAccess(stateType *, int);
+void rdAccess(reuseType *, stateType *, int, int);
+void minRecord(minType *, int, int);
+void printBelady(FILE *);
+int dramRead(dramType *, int, int);
+void dramWrite(dramType *, int, int);
+int vmTranslate(stateType *, int);
+int vmPhys(stateType *, int);
+void livePublish(liveType *, stateType *, int);
+int zipOp(int, int, int, stateType *);
+void printEnergy(FILE *);
+void printZip(FILE *);
+void dumpMem(dumpType *, int);
+void dumpBlock(dumpType *, cache_block *);
+
+/*
+ * Log the specifics of each cache action.
+ *
+ * address is the starting word address of the range of data being transferred.
+ * size is the size of the range of data being transferred.
+ * type specifies the source and destination of the data being transferred.
+ *     cacheToProcessor: reading data from the cache to the processor
+ *     processorToCache: writing data from the processor to the cache
+ *     memoryToCache: reading data from the memory to the cache
+ *     cacheToMemory: evicting cache data by writing it to the memory
+ *     cacheToNowhere: evicting cache data by throwing it away
+ */
+void
+printAction(int address, int size, enum actionType type)
+{
+    if (QUIET)
+        return;
+
+    printf("@@@ transferring word [%d-%d] ", address, address + size - 1);
+    if (type == cacheToProcessor) {
+        printf("from the cache to the processor\n");
+    } else if (type == processorToCache) {
+        printf("from the processor to the cache\n");
+    } else if (type == memoryToCache) {
+        printf("from the memory to the cache\n");
+    } else if (type == cacheToMemory) {
+        printf("from the cache to the memory\n");
+    } else if (type == cacheToNowhere) {
+        printf("from the cache to nowhere\n");
+    }
+}
+
+/*
+ * Finish an access to blk, which now holds the block of addr.
+ */
+int
+cacheAccess(int op, int addr, int val, cache_block *blk, int block_offset,
+    int sector) {
+  blk->access_timestamp = TIMESTAMP;
+
+  if (op == store) {
+    printAction(addr, 1, processorToCache);
+    blk->lines[block_offset] = val;
+    blk->dirty = true;
+    blk->sec_dirty |= 1U << sector;
+    if (DUMP.file != NULL && !blk->changed)
+      dumpBlock(&DUMP, blk);
+    return val;
+  }
+
+  printAction(addr, 1, cacheToProcessor);
+  return blk->lines[block_offset];
+}
+
+/*
+ * Read one sector of blk in from memory.
+ */
+void
+fillSector(stateType *state, cache_block *blk, int sector) {
+  int j;
+  int first = sector * state->sec_size;
+  int head = blk->mem_head + first;
+
+  printAction(head, state->sec_size, memoryToCache);
+  if (DRAM.enabled)
+    dramRead(&DRAM, head, state->sec_size);
+  for (j = 0; j < state->sec_size; ++j) {
+    blk->lines[first + j] = memRead(state, head + j);
+  }
+  STATS.mem_reads += state->sec_size;
+  blk->sec_valid |= 1U << sector;
+  if (DUMP.file != NULL && !blk->changed)
+    dumpBlock(&DUMP, blk);
+}
+
+/*
+ * The block of addr is resident but the sector holding addr isn't.
+ */
+int
+sectorMiss(int op, int addr, int val, stateType *state, cache_block *blk,
+    int block_offset, int sector) {
+  STATS.misses[op]++;
+  STATS.sector_misses++;
+  fillSector(state, blk, sector);
+  return cacheAccess(op, addr, val, blk, block_offset, sector);
+}
+
+/*
+ * Bring the block of addr into set set_index, evicting the lru block if
+ * the set is full, then finish the access. Only the sector holding addr
+ * is filled.
+ */
+int
+cacheMiss(int op, int addr, int val, stateType *state, int set_index, int tag,
+    int block_offset, int sector) {
+  int i;
+  int mem_block_head = addr - block_offset;
+  int bps = state->bps;
+  cache_block *blk;
+
+  STATS.misses[op]++;
+
+  // find an empty block, otherwise make room by evicting the lru block
+  for (i = 0; i < bps; ++i) {
+    if ( !state->CACHE[set_index].blocks[i].valid )
+      break;
+  }
+  if (i == bps) {
+    STATS.set_conflicts[set_index]++;
+    i = kick_lru(set_index, bps, state);
+  }
+
+  blk = &state->CACHE[set_index].blocks[i];
+  blk->tag = tag;
+
+  // Mark block valid
+  blk->valid = true;
+  blk->dirty = false;
+  blk->sec_valid = 0;
+  blk->sec_dirty = 0;
+  blk->mem_head = mem_block_head;
+  blk->owner = OWNER;
+
+  fillSector(state, blk, sector);
+
+  return cacheAccess(op, addr, val, blk, block_offset, sector);
+}
+
+/*
+ * Access kernels. cache_op calls the kernel picked by selectKernel when
+ * the cache was built. For power of two geometries the address is split
+ * with the precomputed shifts and masks, and the common associativities
+ * and block sizes get their own copy of the lookup with those constant,
+ * so the way loop can be unrolled. Anything else goes through the
+ * generic kernel, which divides. A tag match whose sector isn't valid
+ * is a sector miss.
+ */
+#define CACHE_KERNEL(name, WAYS, OFFBITS) \
+int \
+name(int op, int addr, int val, stateType *state) { \
+  int block_offset = addr & ((1 << (OFFBITS)) - 1); \
+  int set_index = (addr >> (OFFBITS)) & state->set_mask; \
+  int tag = addr >> ((OFFBITS) + state->set_bits); \
+  int sector = block_offset >> state->sec_bits; \
+  cache_block *blocks = state->CACHE[set_index].blocks; \
+  int i; \
+\
+  for (i = 0; i < (WAYS); ++i) { \
+    if (blocks[i].tag == tag && blocks[i].valid) { \
+      if ( !(blocks[i].sec_valid & (1U << sector)) ) \
+        return sectorMiss(op, addr, val, state, &blocks[i], block_offset, \
+                          sector); \
+      STATS.hits[op]++; \
+      return cacheAccess(op, addr, val, &blocks[i], block_offset, sector); \
+    } \
+  } \
+  return cacheMiss(op, addr, val, state, set_index, tag, block_offset, \
+                   sector); \
+}
+
+CACHE_KERNEL(cache_op_pow2, state->bps, state->off_bits)
+CACHE_KERNEL(cache_op_1w1, 1, 0)
+CACHE_KERNEL(cache_op_1w4, 1, 2)
+CACHE_KERNEL(cache_op_1w16, 1, 4)
+CACHE_KERNEL(cache_op_2w1, 2, 0)
+CACHE_KERNEL(cache_op_2w4, 2, 2)
+CACHE_KERNEL(cache_op_2w16, 2, 4)
+CACHE_KERNEL(cache_op_4w1, 4, 0)
+CACHE_KERNEL(cache_op_4w4, 4, 2)
+CACHE_KERNEL(cache_op_4w16, 4, 4)
+CACHE_KERNEL(cache_op_8w1, 8, 0)
+CACHE_KERNEL(cache_op_8w4, 8, 2)
+CACHE_KERNEL(cache_op_8w16, 8, 4)
+CACHE_KERNEL(cache_op_16w1, 16, 0)
+CACHE_KERNEL(cache_op_16w4, 16, 2)
+CACHE_KERNEL(cache_op_16w16, 16, 4)
+
+/* indexed by log2 of the associativity and log2 of the block size / 2 */
+static const cacheKernel kernels[5][3] = {
+  { cache_op_1w1, cache_op_1w4, cache_op_1w16 },
+  { cache_op_2w1, cache_op_2w4, cache_op_2w16 },
+  { cache_op_4w1, cache_op_4w4, cache_op_4w16 },
+  { cache_op_8w1, cache_op_8w4, cache_op_8w16 },
+  { cache_op_16w1, cache_op_16w4, cache_op_16w16 },
+};
+
+int
+cache_op_generic(int op, int addr, int val, stateType *state) {
+  int block = addr / state->b_size;
+  int block_offset = addr % state->b_size;
+  int set_index = block % state->n_sets;
+  int tag = block / state->n_sets;
+  int sector = block_offset / state->sec_size;
+  cache_block *blocks = state->CACHE[set_index].blocks;
+  int i;
+
+  for (i = 0; i < state->bps; ++i) {
+    if (blocks[i].tag == tag && blocks[i].valid) {
+      if ( !(blocks[i].sec_valid & (1U << sector)) )
+        return sectorMiss(op, addr, val, state, &blocks[i], block_offset,
+                          sector);
+      STATS.hits[op]++;
+      return cacheAccess(op, addr, val, &blocks[i], block_offset, sector);
+    }
+  }
+  return cacheMiss(op, addr, val, state, set_index, tag, block_offset,
+                   sector);
+}
+
+/*
+ * Returns log2(n) if n is a power of two, otherwise -1.
+ */
+int
+exactLog2(int n) {
+  int bits;
+
+  if (n <= 0 || (n & (n - 1)))
+    return -1;
+  for (bits = 0; (1 << bits) < n; ++bits)
+    ;
+  return bits;
+}
+
+/*
+ * Precompute the address split for the cache geometry and pick a kernel.
+ */
+void
+selectKernel(stateType *state) {
+  int way_bits = exactLog2(state->bps);
+
+  state->off_bits = exactLog2(state->b_size);
+  state->set_bits = exactLog2(state->n_sets);
+  state->sec_bits = exactLog2(state->sec_size);
+
+  if (state->off_bits < 0 || state->set_bits < 0) {
+    state->kernel = cache_op_generic;
+    return;
+  }
+
+  state->set_mask = (1 << state->set_bits) - 1;
+  state->kernel = cache_op_pow2;
+
+  if (way_bits >= 0 && way_bits < 5 && state->off_bits % 2 == 0 &&
+      state->off_bits <= 4)
+    state->kernel = kernels[way_bits][state->off_bits / 2];
+}
+
+int
+cache_op(int op, int addr, int val, stateType *state) {
+  if (VM.enabled && !VM.walking)
+    addr = vmTranslate(state, addr);
+
+  TIMESTAMP++;
+
+  if (TRACE_OUT.file != NULL)
+    tracePut(&TRACE_OUT, op, addr, val);
+
+  if (MP.ucp)
+    umonAccess(state, addr);
+
+  if (RD.last != NULL)
+    rdAccess(&RD, state, op, addr);
+
+  if (MIN.block != NULL)
+    minRecord(&MIN, op, addr / state->b_size);
+
+  if (DRAM.enabled)
+    DRAM.now++;
+
+  if (--LIVE.left == 0)
+    livePublish(&LIVE, state, false);
+
+  if (ZIP.factor)
+    return zipOp(op, addr, val, state);
+
+  return state->kernel(op, addr, val, state);
+}
+
+/*
+ * Write blk back if it's dirty and invalidate it.
+ */
+void
+evictBlock(stateType *state, cache_block *blk) {
+  int i;
+  int j;
+  int k;
+
+  STATS.evictions++;
+  if (blk->owner != OWNER) {
+    MP.prog[OWNER].evicted_others++;
+    MP.prog[blk->owner].evicted_by_others++;
+  }
+
+  if (blk->dirty == true) {
+    STATS.writebacks++;
+
+    //printf("the cache block [%d-%d] was dirty\n", blk->mem_head, blk->mem_head + (b_size -1));
+
+    // only the dirty sectors go back to memory
+    for (i = 0; i * state->sec_size < state->b_size; ++i) {
+      if ( !(blk->sec_dirty & (1U << i)) )
+        continue;
+      j = i * state->sec_size;
+      printAction(blk->mem_head + j, state->sec_size, cacheToMemory);
+      if (DRAM.enabled)
+        dramWrite(&DRAM, blk->mem_head + j, state->sec_size);
+      for (k = 0; k < state->sec_size; ++k, ++j) {
+        memWrite(state, blk->mem_head + j, blk->lines[j]);
+      }
+      STATS.mem_writes += state->sec_size;
+    }
+  }
+  else {
+    printAction(blk->mem_head, state->b_size, cacheToNowhere);
+  }
+
+  // re-init cache block
+  blk->valid = false;
+  blk->dirty = false;
+  blk->sec_valid = 0;
+  blk->sec_dirty = 0;
+  blk->coh = coh_I;
+  blk->snooped = false;
+  blk->access_timestamp = 0;
+  blk->tag = 999;
+  if (DUMP.file != NULL && !blk->changed)
+    dumpBlock(&DUMP, blk);
+}
+
+int
+kick_lru(int s_index, int bps, stateType *state) {
+  int i;
+  int lru;
+  int own;
+  cache_block *blocks = state->CACHE[s_index].blocks;
+
+  /*
+   * With way partitioning only another program's blocks are candidates
+   * while OWNER is under its quota, and only its own once it's at it.
+   */
+  own = -1;
+  if (MP.quota != NULL) {
+    own = 0;
+    for (i = 0; i < bps; ++i)
+      own += (blocks[i].owner == OWNER);
+    own = (own >= MP.quota[OWNER]);
+  }
+
+  lru = -1;
+  for (i = 0; i < bps; ++i) {
+    if (own >= 0 && (blocks[i].owner == OWNER) != own)
+      continue;
+    if (lru < 0 || blocks[i].access_timestamp < blocks[lru].access_timestamp)
+      lru = i;
+  }
+  if (lru < 0) {
+    lru = 0;
+    for (i = 1; i < bps; ++i) {
+      if (blocks[i].access_timestamp < blocks[lru].access_timestamp)
+        lru = i;
+    }
+  }
+
+  evictBlock(state, &blocks[lru]);
+
+  return lru;
+}
+
+/*
+ * Bytes a block of n words compresses to, and the scheme used.
+ */
+int
+zipBytes(int *w, int n, int *scheme)
+{
+  int best = 4 * n;
+  int bytes;
+  int base;
+  int lim;
+  int k;
+  int i;
+  int j;
+
+  *scheme = zip_raw;
+
+  for (i = 0; i < n && w[i] == 0; ++i)
+    ;
+  if (i == n) {
+    *scheme = zip_zero;
+    return 1;
+  }
+
+  for (i = 1; i < n && w[i] == w[0]; ++i)
+    ;
+  if (i == n) {
+    *scheme = zip_repeat;
+    return 4;
+  }
+
+  for (k = 1; k <= 2; ++k) {
+    lim = 1 << (8 * k - 1);
+    base = 0;
+    for (i = 0; i < n && w[i] >= -lim && w[i] < lim; ++i)
+      ;
+    if (i < n)
+      base = w[i];
+    for ( ; i < n; ++i) {
+      if ((w[i] < -lim || w[i] >= lim) &&
+          ((long long)w[i] - base < -lim || (long long)w[i] - base >= lim))
+        break;
+    }
+    bytes = 4 + n * k + (n + 7) / 8;
+    if (i == n && bytes < best) {
+      best = bytes;
+      *scheme = zip_bdi1 + k - 1;
+    }
+  }
+
+  bytes = (3 * n + 7) / 8;
+  for (i = 0; i < n; ++i) {
+    for (j = 0; j < 7 && w[i] != zip_values[j]; ++j)
+      ;
+    if (j == 7)
+      bytes += 4;
+  }
+  if (bytes < best) {
+    best = bytes;
+    *scheme = zip_fvc;
+  }
+
+  return best;
+}
+
+/*
+ * Work out blk's compressed size again, then evict the other blocks of
+ * its set, least recently used first, until the set's data fits.
+ */
+void
+zipFit(stateType *state, int set_index, cache_block *blk) {
+  cache_block *blocks = state->CACHE[set_index].blocks;
+  int scheme;
+  int used;
+  int lru;
+  int i;
+
+  blk->csize = (zipBytes(blk->lines, state->b_size, &scheme) + 3) / 4;
+  ZIP.packs++;
+  ZIP.raw_words += state->b_size;
+  ZIP.packed_words += blk->csize;
+  ZIP.schemes[scheme]++;
+
+  for (;;) {
+    used = 0;
+    lru = -1;
+    for (i = 0; i < state->bps; ++i) {
+      if (!blocks[i].valid)
+        continue;
+      used += blocks[i].csize;
+      if (&blocks[i] != blk &&
+          (lru < 0 || blocks[i].access_timestamp < blocks[lru].access_timestamp))
+        lru = i;
+    }
+    if (used <= ZIP.capacity || lru < 0)
+      break;
+    evictBlock(state, &blocks[lru]);
+    ZIP.evictions++;
+  }
+}
+
+/*
+ * An access to the uncompressed cache, which only keeps tags.
+ */
+void
+zipShadow(stateType *state, int block) {
+  int *tags = &ZIP.shadow[block % state->n_sets * ZIP.ways];
+  long long *times = &ZIP.shadow_time[block % state->n_sets * ZIP.ways];
+  int lru = 0;
+  int i;
+
+  for (i = 0; i < ZIP.ways; ++i) {
+    if (tags[i] == block + 1) {
+      ZIP.shadow_hits++;
+      times[i] = TIMESTAMP;
+      return;
+    }
+    if (times[i] < times[lru])
+      lru = i;
+  }
+  ZIP.shadow_misses++;
+  tags[lru] = block + 1;
+  times[lru] = TIMESTAMP;
+}
+
+/*
+ * A cache access with -z: the access itself, then, if it filled or wrote
+ * a block, making room for its new size.
+ */
+int
+zipOp(int op, int addr, int val, stateType *state) {
+  long long misses = STATS.misses[op];
+  cache_block *blk;
+  int set_index;
+  int tag;
+  int offset;
+
+  zipShadow(state, addr / state->b_size);
+  val = state->kernel(op, addr, val, state);
+  if (op == store || STATS.misses[op] != misses) {
+    splitAddr(state, addr, &set_index, &tag, &offset);
+    blk = findBlock(state, set_index, tag);
+    zipFit(state, set_index, blk);
+  }
+  return val;
+}
+
+void
+initZip(zipType *zip, stateType *state) {
+  zip->ways = state->bps / zip->factor;
+  zip->capacity = zip->ways * state->b_size;
+  zip->shadow = calloc(state->n_sets * zip->ways, sizeof(int));
+  zip->shadow_time = calloc(state->n_sets * zip->ways, sizeof(long long));
+}
+
+/*
+ * Blocks resident in the compressed cache per block of data capacity.
+ */
+double
+zipOccupancy(stateType *state) {
+  long long resident = 0;
+  int i;
+  int j;
+
+  for (i = 0; i < state->n_sets; ++i) {
+    for (j = 0; j < state->bps; ++j)
+      resident += state->CACHE[i].blocks[j].valid;
+  }
+  return (double)resident / ((long long)state->n_sets * ZIP.ways);
+}
+
+void
+printZip(FILE *out) {
+  static const char *zip_names[NUMZIPS] =
+      { "zero", "repeat", "bdi1", "bdi2", "fvc", "raw" };
+  long long hits = 0;
+  long long accesses = 0;
+  int i;
+
+  for (i = 0; i < 3; ++i) {
+    hits += STATS.hits[i];
+    accesses += STATS.hits[i] + STATS.misses[i];
+  }
+  fprintf(out, ",\n    \"compression\": {\n");
+  fprintf(out, "      \"tags_per_way\": %d,\n", ZIP.factor);
+  fprintf(out, "      \"ratio\": %.4f,\n",
+          ZIP.packed_words ? (double)ZIP.raw_words / ZIP.packed_words : 0.0);
+  fprintf(out, "      \"schemes\": {");
+  for (i = 0; i < NUMZIPS; ++i)
+    fprintf(out, "%s\"%s\": %lld", i ? ", " : " ", zip_names[i], ZIP.schemes[i]);
+  fprintf(out, " },\n");
+  fprintf(out, "      \"space_evictions\": %lld,\n", ZIP.evictions);
+  fprintf(out, "      \"blocks_per_way\": %.4f,\n", ZIP.occupancy);
+  fprintf(out, "      \"hit_rate\": %.4f,\n",
+          accesses ? (double)hits / accesses : 0.0);
+  fprintf(out, "      \"uncompressed_hit_rate\": %.4f,\n",
+          accesses ? (double)ZIP.shadow_hits / accesses : 0.0);
+  fprintf(out, "      \"uncompressed_misses\": %lld\n", ZIP.shadow_misses);
+  fprintf(out, "    }");
+}
+
+/*
+ * Add the counters in from to those in to.
+ */
+void
+addStats(statsType *to, statsType *from, int n_sets) {
+  int i;
+
+  to->instrs += from->instrs;
+  for (i = 0; i < 8; ++i)
+    to->opcodes[i] += from->opcodes[i];
+  to->beq_taken += from->beq_taken;
+  to->beq_not_taken += from->beq_not_taken;
+  to->loads += from->loads;
+  to->stores += from->stores;
+  for (i = 0; i < 3; ++i) {
+    to->hits[i] += from->hits[i];
+    to->misses[i] += from->misses[i];
+  }
+  to->evictions += from->evictions;
+  to->writebacks += from->writebacks;
+  to->sector_misses += from->sector_misses;
+  to->mem_reads += from->mem_reads;
+  to->mem_writes += from->mem_writes;
+  for (i = 0; i < n_sets; ++i)
+    to->set_conflicts[i] += from->set_conflicts[i];
+}
+
+/*
+ * Build an empty cache for state.
+ */
+void
+initCache(stateType *state, int b_size, int n_sets, int bps, int sec_size) {
+  int i;
+  int j;
+
+  state->CACHE = malloc( n_sets * sizeof(cache_set) );
+
+  for (i = 0; i < n_sets; ++i) {
+    cache_set new_cache_set;
+
+    new_cache_set.blocks = malloc ( bps * sizeof(cache_block) );
+
+    for (j = 0; j < bps; ++j) {
+      new_cache_set.blocks[j].lines = calloc ( b_size, sizeof(int) );
+      new_cache_set.blocks[j].tag = 999;
+      new_cache_set.blocks[j].valid = false;
+      new_cache_set.blocks[j].dirty = false;
+      new_cache_set.blocks[j].sec_valid = 0;
+      new_cache_set.blocks[j].sec_dirty = 0;
+      new_cache_set.blocks[j].coh = coh_I;
+      new_cache_set.blocks[j].snooped = false;
+      new_cache_set.blocks[j].owner = 0;
+      new_cache_set.blocks[j].access_timestamp = 9999;
+      new_cache_set.blocks[j].changed = false;
+    }
+
+    state->CACHE[i] = new_cache_set;
+  }
+
+  state->b_size = b_size;
+  state->n_sets = n_sets;
+  state->bps = bps;
+  state->sec_size = sec_size;
+  selectKernel(state);
+}
+
+/*
+ * Split addr into set, tag and block offset the way state's kernel does.
+ */
+void
+splitAddr(stateType *state, int addr, int *set_index, int *tag, int *offset) {
+  int block;
+
+  if (state->kernel != cache_op_generic) {
+    *offset = addr & ((1 << state->off_bits) - 1);
+    *set_index = (addr >> state->off_bits) & state->set_mask;
+    *tag = addr >> (state->off_bits + state->set_bits);
+  }
+  else {
+    block = addr / state->b_size;
+    *offset = addr % state->b_size;
+    *set_index = block % state->n_sets;
+    *tag = block / state->n_sets;
+  }
+}
+
+cache_block *
+findBlock(stateType *state, int set_index, int tag) {
+  cache_block *blocks = state->CACHE[set_index].blocks;
+  int i;
+
+  for (i = 0; i < state->bps; ++i) {
+    if (blocks[i].tag == tag && blocks[i].valid)
+      return &blocks[i];
+  }
+  return NULL;
+}
+
+/*
+ * Write a dirty block back to memory on behalf of a snoop.
+ */
+void
+flushBlock(coreType *core, cache_block *blk) {
+  int j;
+
+  for (j = 0; j < core->state.b_size; ++j)
+    memWrite(&core->state, blk->mem_head + j, blk->lines[j]);
+  blk->dirty = false;
+  blk->sec_dirty = 0;
+  core->flushes++;
+}
+
+/*
+ * Put a bus transaction for the block of addr in front of every other
+ * core's cache. Returns the block that supplies the data, if a cache
+ * holds it dirty, and sets *shared if any other cache still holds it
+ * afterwards.
+ */
+cache_block *
+busSnoop(coreType *self, int type, int set_index, int tag, int *shared) {
+  coreType *core;
+  cache_block *blk;
+  cache_block *supplier = NULL;
+  int dirty;
+
+  *shared = false;
+  self->bus[type]++;
+
+  for (core = MULTI.core; core < MULTI.core + MULTI.cores; ++core) {
+    if (core == self || (blk = findBlock(&core->state, set_index, tag)) == NULL)
+      continue;
+
+    dirty = (blk->coh == coh_M || blk->coh == coh_O);
+    if (dirty && type != bus_upgr) {
+      supplier = blk;
+      core->supplies++;
+      // without an O state memory has to be brought up to date
+      if (!MULTI.moesi)
+        flushBlock(core, blk);
+    }
+
+    if (type == bus_rd) {
+      *shared = true;
+      if (blk->coh == coh_M)
+        blk->coh = MULTI.moesi ? coh_O : coh_S;
+      else if (blk->coh == coh_E)
+        blk->coh = coh_S;
+    }
+    else {
+      blk->valid = false;
+      blk->dirty = false;
+      blk->sec_valid = 0;
+      blk->sec_dirty = 0;
+      blk->coh = coh_I;
+      blk->snooped = true;
+      core->invalidations++;
+    }
+  }
+
+  return supplier;
+}
+
+/*
+ * Coherent version of cache_op for a core's private cache. Sets *val to
+ * the word loaded or stored and returns true, or, if bus is false and the
+ * access needs the bus, returns false without touching anything.
+ */
+int
+coherentOp(coreType *core, int op, int addr, int *val, int bus) {
+  stateType *state = &core->state;
+  int set_index;
+  int tag;
+  int block_offset;
+  int shared;
+  int i;
+  cache_block *blk;
+  cache_block *supplier;
+
+  splitAddr(state, addr, &set_index, &tag, &block_offset);
+  blk = findBlock(state, set_index, tag);
+
+  if (blk != NULL && (op != store || blk->coh == coh_M || blk->coh == coh_E)) {
+    TIMESTAMP++;
+    STATS.hits[op]++;
+    if (op == store)
+      blk->coh = coh_M;
+    *val = cacheAccess(op, addr, *val, blk, block_offset, 0);
+    return true;
+  }
+
+  if (!bus)
+    return false;
+
+  TIMESTAMP++;
+
+  // a store to a shared block only has to invalidate the other copies
+  if (blk != NULL) {
+    busSnoop(core, bus_upgr, set_index, tag, &shared);
+    STATS.hits[op]++;
+    blk->coh = coh_M;
+    *val = cacheAccess(op, addr, *val, blk, block_offset, 0);
+    return true;
+  }
+
+  STATS.misses[op]++;
+
+  for (i = 0; i < state->bps; ++i) {
+    blk = &state->CACHE[set_index].blocks[i];
+    if (blk->tag == tag && blk->snooped) {
+      core->coherence_misses++;
+      break;
+    }
+  }
+
+  for (i = 0; i < state->bps; ++i) {
+    if ( !state->CACHE[set_index].blocks[i].valid )
+      break;
+  }
+  if (i == state->bps) {
+    STATS.set_conflicts[set_index]++;
+    i = kick_lru(set_index, state->bps, state);
+  }
+
+  blk = &state->CACHE[set_index].blocks[i];
+  blk->tag = tag;
+  blk->valid = true;
+  blk->dirty = false;
+  blk->sec_valid = 0;
+  blk->sec_dirty = 0;
+  blk->snooped = false;
+  blk->mem_head = addr - block_offset;
+
+  supplier = busSnoop(core, op == store ? bus_rdx : bus_rd, set_index, tag,
+                      &shared);
+  if (supplier != NULL) {
+    memcpy(blk->lines, supplier->lines, state->b_size * sizeof(int));
+    blk->sec_valid = 1;
+  }
+  else
+    fillSector(state, blk, 0);
+
+  if (op == store)
+    blk->coh = coh_M;
+  else
+    blk->coh = shared ? coh_S : coh_E;
+
+  *val = cacheAccess(op, addr, *val, blk, block_offset, 0);
+  return true;
+}
+
+/*
+ * Run one instruction on core. Returns false if the core had to stop for
+ * the bus, the instruction is then restarted from where it stopped.
+ */
+int
+coreStep(coreType *core, int bus) {
+  stateType *state = &core->state;
+  int instr;
+  int opcode;
+  int regA;
+  int regB;
+  int destR;
+  int offset;
+  int val;
+
+  if (!core->fetched) {
+    if ( !coherentOp(core, fetch, state->pc, &core->instr, bus) )
+      return false;
+    core->fetched = true;
+  }
+  instr = core->instr;
+
+  opcode = ( (instr >> 22) & 7 );
+  regA = ( (instr >> 19) & 7 );
+  regB = ( (instr >> 16) & 7 );
+  destR = ( (instr >> 0) & 7 );
+  offset = convertNum( (instr >> 0) & 65535 );
+
+  switch (opcode) {
+    case add:
+    case nand:
+      if (destR == 0)
+        exit(1);
+      if (opcode == add)
+        state->reg[destR] = state->reg[regA] + state->reg[regB];
+      else
+        state->reg[destR] = ~( state->reg[regA] & state->reg[regB] );
+      state->pc++;
+      break;
+
+    case cmov:
+      /* as in main, cmov to register 0 does nothing and a false one stops */
+      if (destR != 0) {
+        if (state->reg[regB] != 0)
+          state->reg[destR] = state->reg[regA];
+        else
+          exit(1);
+      }
+      state->pc++;
+      break;
+
+    case lw:
+      if (regB == 0)
+        exit(1);
+      if ( !coherentOp(core, load, state->reg[regA] + offset, &val, bus) )
+        return false;
+      state->reg[regB] = val;
+      STATS.loads++;
+      state->pc++;
+      break;
+
+    case sw:
+      val = state->reg[regB];
+      if ( !coherentOp(core, store, state->reg[regA] + offset, &val, bus) )
+        return false;
+      STATS.stores++;
+      state->pc++;
+      break;
+
+    case beq:
+      if ( state->reg[regA] == state->reg[regB] ) {
+        state->pc = (state->pc + 1 + offset);
+        STATS.beq_taken++;
+      }
+      else {
+        state->pc++;
+        STATS.beq_not_taken++;
+      }
+      break;
+
+    case halt:
+      core->halted = true;
+      state->pc++;
+      break;
+
+    case noop:
+      state->pc++;
+      break;
+  }
+
+  core->fetched = false;
+  STATS.opcodes[opcode]++;
+  STATS.instrs++;
+  return true;
+}
+
+/*
+ * Run what is left of core's quantum. Counters are kept per thread, so
+ * the core's are swapped in while it runs.
+ */
+void
+coreRun(coreType *core, int bus) {
+  STATS = core->stats;
+  TIMESTAMP = core->timestamp;
+
+  core->stalled = false;
+  while (core->budget > 0 && !core->halted) {
+    if ( !coreStep(core, bus) ) {
+      core->stalled = true;
+      break;
+    }
+    core->budget--;
+  }
+
+  core->stats = STATS;
+  core->timestamp = TIMESTAMP;
+}
+
+void *
+coreThread(void *arg) {
+  int t = (int)(long)arg;
+  int k;
+
+  for (;;) {
+    pthread_barrier_wait(&MULTI.start);
+    if (MULTI.finished)
+      break;
+    for (k = t; k < MULTI.cores; k += MULTI.threads)
+      coreRun(&MULTI.core[k], false);
+    pthread_barrier_wait(&MULTI.done);
+  }
+  return NULL;
+}
+
+/*
+ * Run the program in state on MULTI.cores cores until they have all
+ * halted. Core k starts at pc 0 with k in reg 1. The counters of every
+ * core are summed into STATS.
+ */
+void
+runMulticore(stateType *state, int sec_size) {
+  pthread_t *threads;
+  coreType *core;
+  statsType total = STATS;
+  int running;
+  int i;
+  int k;
+
+  MULTI.core = calloc(MULTI.cores, sizeof(coreType));
+  threads = malloc(MULTI.threads * sizeof(pthread_t));
+  if (MULTI.core == NULL || threads == NULL) {
+    printf("error: can't allocate %d cores\n", MULTI.cores);
+    exit(1);
+  }
+
+  for (k = 0; k < MULTI.cores; ++k) {
+    core = &MULTI.core[k];
+    core->state = *state;
+    initCache(&core->state, state->b_size, state->n_sets, state->bps, sec_size);
+    core->state.reg[1] = k;
+    core->stats.set_conflicts = calloc(state->n_sets, sizeof(long long));
+  }
+
+  pthread_barrier_init(&MULTI.start, NULL, MULTI.threads + 1);
+  pthread_barrier_init(&MULTI.done, NULL, MULTI.threads + 1);
+  for (i = 0; i < MULTI.threads; ++i)
+    pthread_create(&threads[i], NULL, coreThread, (void *)(long)i);
+
+  do {
+    for (k = 0; k < MULTI.cores; ++k)
+      MULTI.core[k].budget = MULTI.quantum;
+
+    pthread_barrier_wait(&MULTI.start);
+    pthread_barrier_wait(&MULTI.done);
+
+    running = 0;
+    for (k = 0; k < MULTI.cores; ++k) {
+      if (MULTI.core[k].stalled)
+        coreRun(&MULTI.core[k], true);
+      running += !MULTI.core[k].halted;
+    }
+    MULTI.quanta++;
+  } while (running);
+
+  MULTI.finished = true;
+  pthread_barrier_wait(&MULTI.start);
+  for (i = 0; i < MULTI.threads; ++i)
+    pthread_join(threads[i], NULL);
+  free(threads);
+
+  for (k = 0; k < MULTI.cores; ++k)
+    addStats(&total, &MULTI.core[k].stats, state->n_sets);
+  STATS = total;
+
+  for (k = 0; k < MULTI.cores; ++k) {
+    core = &MULTI.core[k];
+    printf("core %d: %lld instructions, regs", k, core->stats.instrs);
+    for (i = 0; i < NUMREGS; ++i)
+      printf(" %d", core->state.reg[i]);
+    printf("\n");
+  }
+}
+
+/*
+ * Work out the UCP quotas from the utility monitors with the lookahead
+ * algorithm: every program gets one way, then the rest go one batch at a
+ * time to whichever program gains the most hits per way from its next
+ * batch. The monitor counts are halved afterwards so they follow phase
+ * changes.
+ */
+void
+ucpRepartition(void) {
+  long long *hits;
+  long long gain;
+  double best;
+  int balance;
+  int best_p;
+  int best_k;
+  int p;
+  int k;
+
+  for (p = 0; p < MP.count; ++p)
+    MP.quota[p] = 1;
+  balance = MP.ways - MP.count;
+
+  while (balance > 0) {
+    best = -1;
+    best_p = 0;
+    best_k = balance;
+    for (p = 0; p < MP.count; ++p) {
+      hits = &MP.way_hits[p * MP.ways];
+      gain = 0;
+      for (k = 1; k <= balance; ++k) {
+        gain += hits[MP.quota[p] + k - 1];
+        if ((double)gain / k > best) {
+          best = (double)gain / k;
+          best_p = p;
+          best_k = k;
+        }
+      }
+    }
+    MP.quota[best_p] += best_k;
+    balance -= best_k;
+  }
+
+  for (k = 0; k < MP.count * MP.ways; ++k)
+    MP.way_hits[k] /= 2;
+  MP.repartitions++;
+}
+
+/*
+ * Feed an access by program OWNER to its utility monitor.
+ */
+void
+umonAccess(stateType *state, int addr) {
+  int set_index;
+  int tag;
+  int offset;
+  int *stack;
+  int k;
+
+  splitAddr(state, addr, &set_index, &tag, &offset);
+  if (set_index % MP.stride == 0) {
+    stack = &MP.atd[(OWNER * MP.sampled + set_index / MP.stride) * MP.ways];
+    for (k = 0; k < MP.ways && stack[k] != tag; ++k)
+      ;
+    if (k < MP.ways)
+      MP.way_hits[OWNER * MP.ways + k]++;
+    else
+      k = MP.ways - 1;
+    memmove(stack + 1, stack, k * sizeof(int));
+    stack[0] = tag;
+  }
+
+  if (++MP.accesses % MP.interval == 0)
+    ucpRepartition();
+}
+
+/*
+ * Set up the partitioning named by partition: "equal", "ucp", or a comma
+ * separated list of ways per program. NULL means no partitioning.
+ */
+void
+mpPartition(stateType *state, char *partition) {
+  int p;
+  int sum;
+  char *s;
+
+  if (partition == NULL)
+    return;
+
+  MP.ways = state->bps;
+  MP.quota = calloc(MP.count, sizeof(int));
+  if (MP.ways < MP.count) {
+    printf("error: %d programs can't be partitioned over %d ways\n",
+           MP.count, MP.ways);
+    exit(1);
+  }
+
+  if (!strcmp(partition, "equal") || !strcmp(partition, "ucp")) {
+    for (p = 0; p < MP.count; ++p)
+      MP.quota[p] = MP.ways / MP.count + (p < MP.ways % MP.count);
+  }
+  else {
+    sum = 0;
+    s = partition;
+    for (p = 0; p < MP.count; ++p) {
+      MP.quota[p] = strtol(s, &s, 10);
+      sum += MP.quota[p];
+      if (MP.quota[p] < 0 || *s != (p + 1 < MP.count ? ',' : '\0')) {
+        printf("error: need one way count per program, not %s\n", partition);
+        exit(1);
+      }
+      ++s;
+    }
+    if (sum != MP.ways) {
+      printf("error: way counts add up to %d, the cache has %d ways\n",
+             sum, MP.ways);
+      exit(1);
+    }
+  }
+
+  if (!strcmp(partition, "ucp")) {
+    MP.ucp = true;
+    MP.stride = state->n_sets > 32 ? state->n_sets / 32 : 1;
+    MP.sampled = (state->n_sets + MP.stride - 1) / MP.stride;
+    MP.atd = malloc(MP.count * MP.sampled * MP.ways * sizeof(int));
+    MP.way_hits = calloc(MP.count * MP.ways, sizeof(long long));
+    for (p = 0; p < MP.count * MP.sampled * MP.ways; ++p)
+      MP.atd[p] = -1;
+  }
+}
+
+/*
+ * Load a machine-code file into memory starting at base.
+ */
+void
+loadProgram(stateType *state, char *name, int base) {
+  char line[MAXLINELENGTH];
+  FILE *filePtr;
+  int word;
+  int n;
+
+  filePtr = fopen(name, "r");
+  if (filePtr == NULL) {
+    printf("error: can't open file %s", name);
+    perror("fopen");
+    exit(1);
+  }
+
+  for (n = 0; fgets(line, MAXLINELENGTH, filePtr) != NULL; ++n) {
+    if (sscanf(line, "%d", &word) != 1 || n >= MP.mem) {
+      printf("error in reading address %d of %s\n", n, name);
+      exit(1);
+    }
+    memWrite(state, vmPhys(state, base + n), word);
+  }
+  fclose(filePtr);
+}
+
+/*
+ * Translate an address of program p for the cache.
+ */
+int
+progAddr(progType *p, int addr) {
+  if (addr < 0 || addr >= MP.mem) {
+    printf("error: program %s address %d out of range\n", p->name, addr);
+    exit(1);
+  }
+  return p->base + addr;
+}
+
+/*
+ * Run one instruction of program p.
+ */
+void
+progStep(progType *p, stateType *state) {
+  int instr;
+  int opcode;
+  int regA;
+  int regB;
+  int destR;
+  int offset;
+
+  instr = cache_op( fetch, progAddr(p, p->pc), 0, state );
+
+  opcode = ( (instr >> 22) & 7 );
+  regA = ( (instr >> 19) & 7 );
+  regB = ( (instr >> 16) & 7 );
+  destR = ( (instr >> 0) & 7 );
+  offset = convertNum( (instr >> 0) & 65535 );
+
+  STATS.opcodes[opcode]++;
+  STATS.instrs++;
+
+  switch (opcode) {
+    case add:
+    case nand:
+      if (destR == 0)
+        exit(1);
+      if (opcode == add)
+        p->reg[destR] = p->reg[regA] + p->reg[regB];
+      else
+        p->reg[destR] = ~( p->reg[regA] & p->reg[regB] );
+      p->pc++;
+      break;
+
+    case cmov:
+      /* as in main, cmov to register 0 does nothing and a false one stops */
+      if (destR != 0) {
+        if (p->reg[regB] != 0)
+          p->reg[destR] = p->reg[regA];
+        else
+          exit(1);
+      }
+      p->pc++;
+      break;
+
+    case lw:
+      if (regB == 0)
+        exit(1);
+      p->reg[regB] = cache_op( load, progAddr(p, p->reg[regA] + offset), 0,
+                               state );
+      STATS.loads++;
+      p->pc++;
+      break;
+
+    case sw:
+      cache_op( store, progAddr(p, p->reg[regA] + offset), p->reg[regB], state );
+      STATS.stores++;
+      p->pc++;
+      break;
+
+    case beq:
+      if ( p->reg[regA] == p->reg[regB] ) {
+        p->pc = (p->pc + 1 + offset);
+        STATS.beq_taken++;
+      }
+      else {
+        p->pc++;
+        STATS.beq_not_taken++;
+      }
+      break;
+
+    case halt:
+      p->halted = true;
+      p->pc++;
+      break;
+
+    case noop:
+      p->pc++;
+      break;
+  }
+}
+
+/*
+ * Run every program in MP against the cache in state until they have all
+ * halted, switching between them by MP.schedule. Program 0 was already
+ * loaded by main. The counters of every program are summed into STATS.
+ */
+void
+runPrograms(stateType *state) {
+  statsType total = STATS;
+  progType *p;
+  long long misses;
+  int running;
+  int cur;
+  int n;
+  int k;
+
+  for (k = 0; k < MP.count; ++k) {
+    p = &MP.prog[k];
+    p->base = k * MP.mem;
+    p->stats.set_conflicts = calloc(state->n_sets, sizeof(long long));
+    if (k > 0)
+      loadProgram(state, p->name, p->base);
+  }
+
+  running = MP.count;
+  cur = 0;
+  while (running) {
+    p = &MP.prog[cur];
+    OWNER = cur;
+    STATS = p->stats;
+
+    for (n = 0; n < MP.slice && !p->halted; ++n) {
+      misses = STATS.misses[fetch] + STATS.misses[load] + STATS.misses[store];
+      progStep(p, state);
+      if (MP.schedule == sched_miss &&
+          STATS.misses[fetch] + STATS.misses[load] + STATS.misses[store] != misses)
+        break;
+    }
+
+    p->stats = STATS;
+    if (p->halted)
+      running--;
+
+    // pick the next program that hasn't halted
+    if (MP.schedule == sched_random && running > 0) {
+      MP.seed = MP.seed * 1103515245 + 12345;
+      n = (MP.seed >> 16) % running;
+      for (cur = 0; MP.prog[cur].halted || n-- > 0; ++cur)
+        ;
+    }
+    else if (running > 0) {
+      do
+        cur = (cur + 1) % MP.count;
+      while (MP.prog[cur].halted);
+    }
+  }
+
+  for (k = 0; k < MP.count; ++k)
+    addStats(&total, &MP.prog[k].stats, state->n_sets);
+  STATS = total;
+
+  for (k = 0; k < MP.count; ++k) {
+    p = &MP.prog[k];
+    printf("program %d (%s): %lld instructions, %lld hits, %lld misses\n",
+           k, p->name, p->stats.instrs,
+           p->stats.hits[fetch] + p->stats.hits[load] + p->stats.hits[store],
+           p->stats.misses[fetch] + p->stats.misses[load] + p->stats.misses[store]);
+  }
+}
+
+/*
+ * Memory is a table of PAGESIZE-word pages. Pages are only allocated the
+ * first time they are written, an untouched page reads as all zeroes.
+ */
+void
+initMemory(stateType *statePtr, int words)
+{
+  statePtr->memSize = words;
+  statePtr->numPages = (words + PAGESIZE - 1) >> PAGESHIFT;
+  statePtr->pages = calloc(statePtr->numPages, sizeof(int *));
+
+  if (statePtr->pages == NULL) {
+    printf("error: can't allocate page table for %d words\n", words);
+    exit(1);
+  }
+}
+
+int
+memRead(stateType *statePtr, int addr)
+{
+  int *page;
+
+  if (addr < 0 || addr >= statePtr->memSize) {
+    printf("error: memory address %d out of range\n", addr);
+    exit(1);
+  }
+
+  page = statePtr->pages[addr >> PAGESHIFT];
+  if (page == NULL)
+    return 0;
+
+  return page[addr & (PAGESIZE - 1)];
+}
+
+void
+memWrite(stateType *statePtr, int addr, int val)
+{
+  int **page;
+
+  if (addr < 0 || addr >= statePtr->memSize) {
+    printf("error: memory address %d out of range\n", addr);
+    exit(1);
+  }
+
+  page = &statePtr->pages[addr >> PAGESHIFT];
+  if (*page == NULL) {
+    if (val == 0)
+      return;
+
+    *page = calloc(PAGESIZE, sizeof(int));
+    if (*page == NULL) {
+      printf("error: can't allocate page for address %d\n", addr);
+      exit(1);
+    }
+  }
+
+  (*page)[addr & (PAGESIZE - 1)] = val;
+  if (DUMP.written != NULL && !DUMP.written[addr >> DUMPCHUNKBITS])
+    dumpMem(&DUMP, addr);
+}
+
+/*
+ * Snapshot src into dst. Only the pages src has touched are copied.
+ */
+void
+copyState(stateType *dst, stateType *src)
+{
+  int i;
+
+  *dst = *src;
+  dst->pages = calloc(src->numPages, sizeof(int *));
+  if (dst->pages == NULL) {
+    printf("error: can't allocate page table for snapshot\n");
+    exit(1);
+  }
+
+  for (i = 0; i < src->numPages; ++i) {
+    if (src->pages[i] != NULL) {
+      dst->pages[i] = malloc(PAGESIZE * sizeof(int));
+      if (dst->pages[i] == NULL) {
+        printf("error: can't allocate page for snapshot\n");
+        exit(1);
+      }
+      memcpy(dst->pages[i], src->pages[i], PAGESIZE * sizeof(int));
+    }
+  }
+}
+
+void
+freeState(stateType *statePtr)
+{
+  int i;
+
+  for (i = 0; i < statePtr->numPages; ++i)
+    free(statePtr->pages[i]);
+
+  free(statePtr->pages);
+  statePtr->pages = NULL;
+  statePtr->numPages = 0;
+}
+
+int
+putVarint(unsigned char *p, unsigned int v)
+{
+  int n = 0;
+
+  while (v >= 0x80) {
+    p[n++] = (v & 0x7f) | 0x80;
+    v >>= 7;
+  }
+  p[n++] = v;
+  return n;
+}
+
+/*
+ * Decode a varint at p[*pos], stopping at end. Returns 0 if truncated.
+ */
+int
+getVarint(unsigned char *p, int *pos, int end, unsigned int *v)
+{
+  int shift;
+  int c;
+
+  *v = 0;
+  for (shift = 0; shift < 35 && *pos < end; shift += 7) {
+    c = p[(*pos)++];
+    *v |= (unsigned int)(c & 0x7f) << shift;
+    if ( !(c & 0x80) )
+      return 1;
+  }
+  return 0;
+}
+
+unsigned int
+zigzag(int n)
+{
+  return ((unsigned int)n << 1) ^ (unsigned int)(n >> 31);
+}
+
+int
+unzigzag(unsigned int n)
+{
+  return (int)(n >> 1) ^ -(int)(n & 1);
+}
+
+void
+putWord(FILE *f, unsigned int v)
+{
+  putc(v & 0xff, f);
+  putc((v >> 8) & 0xff, f);
+  putc((v >> 16) & 0xff, f);
+  putc((v >> 24) & 0xff, f);
+}
+
+/*
+ * Returns 0 at end of file.
+ */
+int
+getWord(FILE *f, unsigned int *v)
+{
+  unsigned char b[4];
+
+  if (fread(b, 1, 4, f) != 4)
+    return 0;
+  *v = b[0] | (b[1] << 8) | (b[2] << 16) | ((unsigned int)b[3] << 24);
+  return 1;
+}
+
+/*
+ * LZ block compression in the style of LZ4. The output is a series of
+ * sequences: a token byte with the literal count in the high nibble and
+ * the match length - 4 in the low nibble (15 means more length bytes
+ * follow, each adding up to 255), the literals, then a 2-byte match
+ * offset and the extra match length bytes. The last sequence has only
+ * literals.
+ */
+int
+lzLength(unsigned char *dst, int op, int n)
+{
+  for ( ; n >= 255; n -= 255)
+    dst[op++] = 255;
+  dst[op++] = n;
+  return op;
+}
+
+int
+lzSequence(unsigned char *dst, int op, unsigned char *lit, int nlit,
+    int offset, int mlen)
+{
+  int token = (nlit < 15 ? nlit : 15) << 4;
+
+  if (mlen)
+    token |= (mlen - 4 < 15 ? mlen - 4 : 15);
+  dst[op++] = token;
+
+  if (nlit >= 15)
+    op = lzLength(dst, op, nlit - 15);
+  memcpy(dst + op, lit, nlit);
+  op += nlit;
+
+  if (mlen) {
+    dst[op++] = offset & 0xff;
+    dst[op++] = offset >> 8;
+    if (mlen - 4 >= 15)
+      op = lzLength(dst, op, mlen - 4 - 15);
+  }
+  return op;
+}
+
+int
+lzCompress(unsigned char *src, int len, unsigned char *dst)
+{
+  int table[1 << LZHASHBITS];
+  unsigned int seq;
+  int ip;
+  int ref;
+  int anchor;
+  int op;
+  int mlen;
+  int h;
+
+  for (h = 0; h < (1 << LZHASHBITS); ++h)
+    table[h] = -1;
+
+  ip = anchor = op = 0;
+  while (ip + 4 <= len) {
+    memcpy(&seq, src + ip, 4);
+    h = (seq * 2654435761U) >> (32 - LZHASHBITS);
+    ref = table[h];
+    table[h] = ip;
+
+    if (ref < 0 || ip - ref > 65535 || memcmp(src + ref, src + ip, 4)) {
+      ip++;
+      continue;
+    }
+
+    for (mlen = 4; ip + mlen < len && src[ref + mlen] == src[ip + mlen]; ++mlen)
+      ;
+
+    op = lzSequence(dst, op, src + anchor, ip - anchor, ip - ref, mlen);
+    ip += mlen;
+    anchor = ip;
+  }
+
+  return lzSequence(dst, op, src + anchor, len - anchor, 0, 0);
+}
+
+/*
+ * Returns the decompressed length, or -1 if src is corrupt.
+ */
+int
+lzDecompress(unsigned char *src, int len, unsigned char *dst, int cap)
+{
+  int ip = 0;
+  int op = 0;
+  int token;
+  int n;
+  int c;
+  int offset;
+
+  while (ip < len) {
+    token = src[ip++];
+
+    n = token >> 4;
+    if (n == 15) {
+      do {
+        if (ip >= len)
+          return -1;
+        n += (c = src[ip++]);
+      } while (c == 255);
+    }
+    if (ip + n > len || op + n > cap)
+      return -1;
+    memcpy(dst + op, src + ip, n);
+    ip += n;
+    op += n;
+
+    if (ip == len)
+      break;
+
+    if (ip + 2 > len)
+      return -1;
+    offset = src[ip] | (src[ip + 1] << 8);
+    ip += 2;
+
+    n = (token & 15) + 4;
+    if ((token & 15) == 15) {
+      do {
+        if (ip >= len)
+          return -1;
+        n += (c = src[ip++]);
+      } while (c == 255);
+    }
+    if (offset == 0 || offset > op || op + n > cap)
+      return -1;
+
+    /* byte at a time, matches may overlap their own output */
+    for ( ; n > 0; --n, ++op)
+      dst[op] = dst[op - offset];
+  }
+
+  return op;
+}
+
+void
+traceCreate(traceType *trace, char *name)
+{
+  memset(trace, 0, sizeof(traceType));
+  trace->binary = true;
+  trace->file = fopen(name, "wb");
+  if (trace->file == NULL) {
+    printf("error: can't open trace file %s", name);
+    perror("fopen");
+    exit(1);
+  }
+  fwrite(TRACEMAGIC, 1, 4, trace->file);
+
+  trace->buf = malloc(CHUNKSIZE);
+  trace->zbuf = malloc(ZCHUNKSIZE);
+}
+
+void
+traceFlush(traceType *trace)
+{
+  int zlen;
+
+  if (trace->pos == 0)
+    return;
+
+  zlen = lzCompress(trace->buf, trace->pos, trace->zbuf);
+
+  putWord(trace->file, trace->pos);
+  if (zlen < trace->pos) {
+    putWord(trace->file, zlen);
+    fwrite(trace->zbuf, 1, zlen, trace->file);
+  }
+  else {
+    putWord(trace->file, trace->pos);
+    fwrite(trace->buf, 1, trace->pos, trace->file);
+  }
+
+  trace->pos = 0;
+  memset(trace->last_addr, 0, sizeof(trace->last_addr));
+}
+
+void
+tracePut(traceType *trace, int type, int addr, int val)
+{
+  if (trace->pos > CHUNKSIZE - MAXRECORD)
+    traceFlush(trace);
+
+  trace->buf[trace->pos++] = type;
+  trace->pos += putVarint(trace->buf + trace->pos,
+                          zigzag(addr - trace->last_addr[type]));
+  trace->last_addr[type] = addr;
+
+  if (type == store)
+    trace->pos += putVarint(trace->buf + trace->pos, zigzag(val));
+}
+
+/*
+ * Reader thread: decompress chunks into the ring until the end of the
+ * trace, which is marked with an empty chunk.
+ */
+void *
+traceReader(void *arg)
+{
+  traceType *trace = arg;
+  unsigned char *zbuf = malloc(ZCHUNKSIZE);
+  unsigned int raw_len;
+  unsigned int z_len;
+  chunkType *chunk;
+  int done = false;
+
+  while (!done) {
+    pthread_mutex_lock(&trace->lock);
+    while (trace->count == NUMCHUNKBUFS)
+      pthread_cond_wait(&trace->drained, &trace->lock);
+    chunk = &trace->ring[(trace->head + trace->count) % NUMCHUNKBUFS];
+    pthread_mutex_unlock(&trace->lock);
+
+    /* the slot isn't visible to the replay loop until count goes up */
+    if (!getWord(trace->file, &raw_len)) {
+      chunk->len = 0;
+      done = true;
+    }
+    else if (!getWord(trace->file, &z_len) || raw_len == 0 ||
+             raw_len > CHUNKSIZE || z_len > raw_len ||
+             fread(zbuf, 1, z_len, trace->file) != z_len) {
+      printf("error: truncated or corrupt trace\n");
+      exit(1);
+    }
+    else if (z_len == raw_len) {
+      memcpy(chunk->data, zbuf, raw_len);
+      chunk->len = raw_len;
+    }
+    else if ( (chunk->len = lzDecompress(zbuf, z_len, chunk->data, CHUNKSIZE))
+              != raw_len ) {
+      printf("error: corrupt compressed chunk in trace\n");
+      exit(1);
+    }
+
+    pthread_mutex_lock(&trace->lock);
+    trace->count++;
+    pthread_cond_signal(&trace->filled);
+    pthread_mutex_unlock(&trace->lock);
+  }
+
+  free(zbuf);
+  return NULL;
+}
+
+void
+traceOpen(traceType *trace, char *name)
+{
+  char magic[4];
+
+  memset(trace, 0, sizeof(traceType));
+  trace->file = fopen(name, "rb");
+  if (trace->file == NULL) {
+    printf("error: can't open trace file %s", name);
+    perror("fopen");
+    exit(1);
+  }
+
+  trace->binary = fread(magic, 1, 4, trace->file) == 4 &&
+                  !memcmp(magic, TRACEMAGIC, 4);
+  if (!trace->binary) {
+    rewind(trace->file);
+    return;
+  }
+
+  trace->ring = malloc(NUMCHUNKBUFS * sizeof(chunkType));
+  pthread_mutex_init(&trace->lock, NULL);
+  pthread_cond_init(&trace->filled, NULL);
+  pthread_cond_init(&trace->drained, NULL);
+  if (pthread_create(&trace->reader, NULL, traceReader, trace)) {
+    printf("error: can't start trace reader thread\n");
+    exit(1);
+  }
+}
+
+/*
+ * Move the replay loop on to the next decompressed chunk. Returns 0 at
+ * the end of the trace.
+ */
+int
+traceNextChunk(traceType *trace)
+{
+  pthread_mutex_lock(&trace->lock);
+  if (trace->buf != NULL) {
+    trace->head = (trace->head + 1) % NUMCHUNKBUFS;
+    trace->count--;
+    pthread_cond_signal(&trace->drained);
+  }
+  while (trace->count == 0)
+    pthread_cond_wait(&trace->filled, &trace->lock);
+  pthread_mutex_unlock(&trace->lock);
+
+  trace->buf = trace->ring[trace->head].data;
+  trace->len = trace->ring[trace->head].len;
+  trace->pos = 0;
+  memset(trace->last_addr, 0, sizeof(trace->last_addr));
+
+  return trace->len != 0;
+}
+
+/*
+ * Read the next access of a trace. Returns 0 at end of trace.
+ */
+int
+traceGet(traceType *trace, int *type, int *addr, int *val)
+{
+  char line[MAXLINELENGTH];
+  char kind;
+  unsigned int v;
+  unsigned int w;
+  int c;
+
+  *val = 0;
+
+  if (!trace->binary) {
+    while (fgets(line, MAXLINELENGTH, trace->file) != NULL) {
+      if (line[0] == '#' || sscanf(line, " %c", &kind) != 1)
+        continue;
+
+      if (kind == 'f' && sscanf(line, " %*c %d", addr) == 1)
+        *type = fetch;
+      else if (kind == 'l' && sscanf(line, " %*c %d", addr) == 1)
+        *type = load;
+      else if (kind == 's' && sscanf(line, " %*c %d %d", addr, val) == 2)
+        *type = store;
+      else {
+        printf("error: bad trace line %s", line);
+        exit(1);
+      }
+      return 1;
+    }
+    return 0;
+  }
+
+  if (trace->pos == trace->len && !traceNextChunk(trace))
+    return 0;
+
+  c = trace->buf[trace->pos++];
+  if (c > load || !getVarint(trace->buf, &trace->pos, trace->len, &v) ||
+      (c == store && !getVarint(trace->buf, &trace->pos, trace->len, &w))) {
+    printf("error: truncated or corrupt trace\n");
+    exit(1);
+  }
+
+  *type = c;
+  *addr = trace->last_addr[c] + unzigzag(v);
+  trace->last_addr[c] = *addr;
+  if (c == store)
+    *val = unzigzag(w);
+
+  return 1;
+}
+
+void
+traceClose(traceType *trace)
+{
+  if (trace->file == NULL)
+    return;
+
+  if (trace->zbuf != NULL) {
+    traceFlush(trace);
+    free(trace->buf);
+    free(trace->zbuf);
+  }
+  else if (trace->ring != NULL) {
+    pthread_join(trace->reader, NULL);
+    free(trace->ring);
+  }
+
+  fclose(trace->file);
+  trace->file = NULL;
+}
+
+/*
+ * Drive the cache with a recorded reference stream instead of a program.
+ */
+void
+replayTrace(traceType *trace, stateType *state)
+{
+  int type;
+  int addr;
+  int val;
+
+  while (traceGet(trace, &type, &addr, &val)) {
+    cache_op(type, addr, val, state);
+
+    if (type == load)
+      STATS.loads++;
+    else if (type == store)
+      STATS.stores++;
+  }
+}
+
+long long
+liveClock(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+void
+liveOpen(liveType *live, char *name, char *prog)
+{
+  int fd;
+  char *base = strrchr(prog, '/') ? strrchr(prog, '/') + 1 : prog;
+
+  /* a new file, so a viewer still mapping the last run's never sees it shrink */
+  unlink(name);
+  fd = open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+  if (fd < 0 || ftruncate(fd, sizeof(liveShared)) < 0) {
+    printf("error: can't create live stats file %s", name);
+    perror("open");
+    exit(1);
+  }
+  live->shm = mmap(NULL, sizeof(liveShared), PROT_READ | PROT_WRITE,
+                   MAP_SHARED, fd, 0);
+  close(fd);
+  if (live->shm == MAP_FAILED) {
+    printf("error: can't map live stats file %s", name);
+    perror("mmap");
+    exit(1);
+  }
+
+  live->shm->pid = getpid();
+  live->shm->cache = true;
+  live->shm->start_ns = liveClock();
+  strncpy(live->shm->sim, "proj2", sizeof(live->shm->sim) - 1);
+  strncpy(live->shm->name, base, sizeof(live->shm->name) - 1);
+  __atomic_store_n(&live->shm->magic, LIVEMAGIC, __ATOMIC_RELEASE);
+  live->left = LIVEINTERVAL;
+}
+
+void
+livePublish(liveType *live, stateType *state, int done)
+{
+  liveShared *shm = live->shm;
+  unsigned seq = shm->seq;
+  long long hits = 0;
+  long long misses = 0;
+  int i;
+
+  for (i = 0; i < 3; ++i) {
+    hits += STATS.hits[i];
+    misses += STATS.misses[i];
+  }
+
+  __atomic_store_n(&shm->seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  shm->pc = state->pc;
+  shm->instrs = STATS.instrs;
+  shm->accesses = hits + misses;
+  shm->hits = hits;
+  shm->misses = misses;
+  shm->now_ns = liveClock();
+  shm->done = done;
+  __atomic_store_n(&shm->seq, seq + 2, __ATOMIC_RELEASE);
+
+  live->left = LIVEINTERVAL;
+}
+
+void
+rdInit(reuseType *rd, stateType *state, int pcs)
+{
+  rd->blocks = state->memSize / state->b_size + 1;
+  rd->cap = 2 * rd->blocks;
+  rd->last = calloc(rd->blocks, sizeof(int));
+  rd->owner = calloc(rd->cap + 1, sizeof(int));
+  rd->tree = calloc(rd->cap + 1, sizeof(int));
+  rd->heat = calloc(3 * (long)rd->blocks, sizeof(long long));
+  rd->pcs = pcs;
+  rd->pc_hist = calloc((long)pcs * (RDBUCKETS + 1), sizeof(long long));
+  rd->pc = -1;
+
+  if (rd->last == NULL || rd->owner == NULL || rd->tree == NULL ||
+      rd->heat == NULL || rd->pc_hist == NULL) {
+    printf("error: can't allocate reuse distance tables\n");
+    exit(1);
+  }
+}
+
+void
+treeAdd(reuseType *rd, int t, int n)
+{
+  for ( ; t <= rd->cap; t += t & -t)
+    rd->tree[t] += n;
+}
+
+int
+treeSum(reuseType *rd, int t)
+{
+  int sum = 0;
+
+  for ( ; t > 0; t -= t & -t)
+    sum += rd->tree[t];
+  return sum;
+}
+
+/*
+ * Renumber the live access times 1..n, keeping their order.
+ */
+void
+rdCompact(reuseType *rd)
+{
+  int t;
+  int n = 0;
+  int block;
+
+  memset(rd->tree, 0, (rd->cap + 1) * sizeof(int));
+  for (t = 1; t <= rd->now; ++t) {
+    block = rd->owner[t];
+    if (rd->last[block] != t)
+      continue;
+    rd->last[block] = ++n;
+    rd->owner[n] = block;
+    treeAdd(rd, n, 1);
+  }
+  rd->now = n;
+}
+
+int
+rdBucket(int distance)
+{
+  int b = 0;
+
+  while (distance > 0) {
+    distance >>= 1;
+    b++;
+  }
+  return b;
+}
+
+void
+rdAccess(reuseType *rd, stateType *state, int op, int addr)
+{
+  int block = addr / state->b_size;
+  int b;
+  long long *pc_hist;
+
+  /* out of range, memRead stops the simulator when the kernel gets to it */
+  if (addr < 0 || block >= rd->blocks)
+    return;
+
+  if (rd->now == rd->cap)
+    rdCompact(rd);
+  rd->now++;
+
+  pc_hist = NULL;
+  if (rd->pc >= 0 && rd->pc < rd->pcs)
+    pc_hist = &rd->pc_hist[(long)rd->pc * (RDBUCKETS + 1)];
+
+  if (rd->last[block] == 0) {
+    rd->cold[op]++;
+    if (pc_hist != NULL)
+      pc_hist[RDBUCKETS]++;
+  }
+  else {
+    b = rdBucket(treeSum(rd, rd->now - 1) - treeSum(rd, rd->last[block]));
+    rd->hist[op][b]++;
+    if (pc_hist != NULL)
+      pc_hist[b]++;
+    treeAdd(rd, rd->last[block], -1);
+  }
+
+  treeAdd(rd, rd->now, 1);
+  rd->last[block] = rd->now;
+  rd->owner[rd->now] = block;
+  rd->heat[3 * (long)block + op]++;
+}
+
+void
+printHist(FILE *out, long long *hist)
+{
+  int b;
+
+  fprintf(out, "[");
+  for (b = 0; b < RDBUCKETS; ++b)
+    fprintf(out, "%s%lld", b ? ", " : " ", hist[b]);
+  fprintf(out, " ]");
+}
+
+/*
+ * Write the analysis as JSON: reuse distance histograms per access type
+ * and per pc, the hit ratio of a fully associative lru cache of 2^k
+ * blocks for each k, accesses to every block touched, and the
+ * accesses, distinct blocks and conflict misses of every set.
+ */
+void
+printReuse(reuseType *rd, stateType *state, char *name)
+{
+  static const char *access_names[3] = { "fetch", "sw", "lw" };
+  long long all[RDBUCKETS];
+  long long cold = 0;
+  long long total = 0;
+  long long hits;
+  long long *heat;
+  long long *set_acc;
+  int *set_blocks;
+  FILE *out;
+  int first;
+  int op;
+  int b;
+  int i;
+
+  if ( (out = fopen(name, "w")) == NULL ) {
+    printf("error: can't open reuse distance file %s", name);
+    perror("fopen");
+    exit(1);
+  }
+
+  memset(all, 0, sizeof(all));
+  for (op = 0; op < 3; ++op) {
+    cold += rd->cold[op];
+    for (b = 0; b < RDBUCKETS; ++b)
+      all[b] += rd->hist[op][b];
+  }
+  for (b = 0; b < RDBUCKETS; ++b)
+    total += all[b];
+  total += cold;
+
+  fprintf(out, "{\n  \"block_size\": %d,\n", state->b_size);
+  fprintf(out, "  \"accesses\": %lld,\n", total);
+  fprintf(out, "  \"bucket_min\": [ 0");
+  for (b = 1; b < RDBUCKETS; ++b)
+    fprintf(out, ", %u", 1U << (b - 1));
+  fprintf(out, " ],\n  \"reuse\": {\n");
+  for (op = 0; op < 3; ++op) {
+    fprintf(out, "    \"%s\": { \"cold\": %lld, \"hist\": ", access_names[op],
+            rd->cold[op]);
+    printHist(out, rd->hist[op]);
+    fprintf(out, " },\n");
+  }
+  fprintf(out, "    \"all\": { \"cold\": %lld, \"hist\": ", cold);
+  printHist(out, all);
+  fprintf(out, " }\n  },\n");
+
+  /* a cache of 2^k blocks hits every access in buckets 0 to k */
+  fprintf(out, "  \"lru_hit_ratio\": [");
+  for (hits = 0, b = 0; b < RDBUCKETS; ++b) {
+    hits += all[b];
+    fprintf(out, "%s%.4f", b ? ", " : " ", total ? (double)hits / total : 0.0);
+  }
+  fprintf(out, " ],\n");
+
+  fprintf(out, "  \"pcs\": [");
+  for (first = true, i = 0; i < rd->pcs; ++i) {
+    long long *h = &rd->pc_hist[(long)i * (RDBUCKETS + 1)];
+
+    for (total = 0, b = 0; b <= RDBUCKETS; ++b)
+      total += h[b];
+    if (total == 0)
+      continue;
+    fprintf(out, "%s\n    { \"pc\": %d, \"accesses\": %lld, \"cold\": %lld, \"hist\": ",
+            first ? "" : ",", i, total, h[RDBUCKETS]);
+    printHist(out, h);
+    fprintf(out, " }");
+    first = false;
+  }
+  fprintf(out, "\n  ],\n");
+
+  set_acc = calloc(state->n_sets, sizeof(long long));
+  set_blocks = calloc(state->n_sets, sizeof(int));
+  fprintf(out, "  \"blocks\": [");
+  for (first = true, i = 0; i < rd->blocks; ++i) {
+    heat = &rd->heat[3 * (long)i];
+    if (heat[fetch] + heat[load] + heat[store] == 0)
+      continue;
+    set_acc[i % state->n_sets] += heat[fetch] + heat[load] + heat[store];
+    set_blocks[i % state->n_sets]++;
+    fprintf(out, "%s\n    { \"addr\": %ld, \"fetch\": %lld, \"lw\": %lld, \"sw\": %lld }",
+            first ? "" : ",", (long)i * state->b_size, heat[fetch],
+            heat[load], heat[store]);
+    first = false;
+  }
+  fprintf(out, "\n  ],\n");
+
+  fprintf(out, "  \"sets\": [");
+  for (i = 0; i < state->n_sets; ++i)
+    fprintf(out, "%s\n    { \"accesses\": %lld, \"blocks\": %d, \"conflicts\": %lld }",
+            i ? "," : "", set_acc[i], set_blocks[i], STATS.set_conflicts[i]);
+  fprintf(out, "\n  ]\n}\n");
+
+  free(set_acc);
+  free(set_blocks);
+  fclose(out);
+}
+
+void
+minInit(minType *min)
+{
+  min->size = 1 << 16;
+  min->block = malloc(min->size * sizeof(int));
+  min->type = malloc(min->size);
+  if (min->block == NULL || min->type == NULL) {
+    printf("error: can't allocate -opt accesses\n");
+    exit(1);
+  }
+}
+
+void
+minRecord(minType *min, int op, int block)
+{
+  if (min->n == min->size) {
+    if (min->size > INT_MAX / 2) {
+      printf("error: too many accesses for -opt\n");
+      exit(1);
+    }
+    min->size *= 2;
+    min->block = realloc(min->block, min->size * sizeof(int));
+    min->type = realloc(min->type, min->size);
+    if (min->block == NULL || min->type == NULL) {
+      printf("error: can't allocate %d accesses for -opt\n", min->size);
+      exit(1);
+    }
+  }
+  min->block[min->n] = block;
+  min->type[min->n++] = op;
+}
+
+/*
+ * Sift entry i of heap h (next uses key, blocks block) up or down,
+ * keeping where[] pointing at each block's entry.
+ */
+void
+minSift(int *key, int *block, int n, int i, int *where)
+{
+  int k = key[i];
+  int b = block[i];
+  int c;
+
+  while (i > 0 && key[(i - 1) / 2] < k) {
+    key[i] = key[(i - 1) / 2];
+    block[i] = block[(i - 1) / 2];
+    where[block[i]] = i;
+    i = (i - 1) / 2;
+  }
+  while ( (c = 2 * i + 1) < n ) {
+    if (c + 1 < n && key[c + 1] > key[c])
+      c++;
+    if (key[c] <= k)
+      break;
+    key[i] = key[c];
+    block[i] = block[c];
+    where[block[i]] = i;
+    i = c;
+  }
+  key[i] = k;
+  block[i] = b;
+  where[b] = i;
+}
+
+void
+minRun(minType *min, stateType *state)
+{
+  int blocks = state->memSize / state->b_size + 1;
+  int ways = state->bps;
+  int *next = malloc(min->n * sizeof(int));
+  int *where = malloc(blocks * sizeof(int));
+  int *key = malloc(state->n_sets * ways * sizeof(int));
+  int *held = malloc(state->n_sets * ways * sizeof(int));
+  int *count = calloc(state->n_sets, sizeof(int));
+  int b;
+  int i;
+  int set;
+  int base;
+
+  if (next == NULL || where == NULL || key == NULL || held == NULL ||
+      count == NULL) {
+    printf("error: can't allocate -opt tables\n");
+    exit(1);
+  }
+
+  /* where[] first holds the next access to each block, INT_MAX is never */
+  for (b = 0; b < blocks; ++b)
+    where[b] = INT_MAX;
+  for (i = min->n - 1; i >= 0; --i) {
+    next[i] = where[min->block[i]];
+    where[min->block[i]] = i;
+  }
+
+  /* then the heap slot holding each block, -1 if not cached */
+  for (b = 0; b < blocks; ++b)
+    where[b] = -1;
+
+  for (i = 0; i < min->n; ++i) {
+    b = min->block[i];
+    set = b % state->n_sets;
+    base = set * ways;
+
+    if (where[b] >= 0) {
+      key[base + where[b]] = next[i];
+      minSift(key + base, held + base, count[set], where[b], where);
+      continue;
+    }
+
+    min->misses[min->type[i]]++;
+    if (count[set] < ways) {
+      key[base + count[set]] = next[i];
+      held[base + count[set]] = b;
+      minSift(key + base, held + base, count[set] + 1, count[set], where);
+      count[set]++;
+    }
+    else {
+      where[held[base]] = -1;
+      key[base] = next[i];
+      held[base] = b;
+      minSift(key + base, held + base, count[set], 0, where);
+    }
+  }
+
+  free(next);
+  free(where);
+  free(key);
+  free(held);
+  free(count);
+}
+
+/*
+ * Returns the predictor kind called name, or -1.
+ */
+int
+bpKind(char *name)
+{
+  int i;
+
+  for (i = 0; i < NUMPREDICTORS; ++i)
+    if (!strcmp(name, bp_names[i]))
+      return i;
+  return -1;
+}
+
+void
+bpInit(predictorType *bp)
+{
+  int i;
+
+  bp->bimodal = malloc(1 << BPTABLEBITS);
+  bp->gshare = malloc(1 << BPTABLEBITS);
+  bp->chooser = malloc(1 << BPTABLEBITS);
+  memset(bp->bimodal, 1, 1 << BPTABLEBITS);
+  memset(bp->gshare, 1, 1 << BPTABLEBITS);
+  memset(bp->chooser, 1, 1 << BPTABLEBITS);
+
+  for (i = 0; i < TAGETABLES; ++i)
+    bp->tage[i] = calloc(1 << TAGEBITS, sizeof(tageEntry));
+
+  for (i = 0; i < BTBENTRIES; ++i)
+    bp->btb_pc[i] = -1;
+}
+
+void
+bpFree(predictorType *bp)
+{
+  int i;
+
+  free(bp->bimodal);
+  free(bp->gshare);
+  free(bp->chooser);
+  for (i = 0; i < TAGETABLES; ++i)
+    free(bp->tage[i]);
+}
+
+void
+counterUpdate(unsigned char *ctr, int taken)
+{
+  if (taken && *ctr < 3)
+    (*ctr)++;
+  else if (!taken && *ctr > 0)
+    (*ctr)--;
+}
+
+/*
+ * The newest len bits of history folded down to bits bits.
+ */
+unsigned int
+foldHistory(unsigned int history, int len, int bits)
+{
+  unsigned int h = (len < 32) ? history & ((1U << len) - 1) : history;
+  unsigned int folded = 0;
+
+  for ( ; h != 0; h >>= bits)
+    folded ^= h & ((1U << bits) - 1);
+  return folded;
+}
+
+/*
+ * TAGE-lite: a bimodal base predictor and TAGETABLES tagged tables
+ * indexed with geometrically longer global histories. The longest
+ * matching table provides the prediction.
+ */
+int
+tagePredict(predictorType *bp, int pc, int taken)
+{
+  unsigned int idx[TAGETABLES];
+  unsigned int tag[TAGETABLES];
+  int provider = -1;
+  int altpred;
+  int pred;
+  tageEntry *e;
+  int i;
+
+  for (i = 0; i < TAGETABLES; ++i) {
+    idx[i] = (pc ^ (pc >> TAGEBITS) ^
+              foldHistory(bp->history, tage_history[i], TAGEBITS)) &
+             ((1 << TAGEBITS) - 1);
+    tag[i] = ((pc * 7) ^ foldHistory(bp->history, tage_history[i], 8)) & 0xff;
+    tag[i] |= 0x100; /* tag 0 marks an empty entry */
+    if (bp->tage[i][idx[i]].tag == tag[i])
+      provider = i;
+  }
+
+  altpred = bp->bimodal[pc & ((1 << BPTABLEBITS) - 1)] >= 2;
+  for (i = provider - 1; i >= 0; --i) {
+    if (bp->tage[i][idx[i]].tag == tag[i]) {
+      altpred = bp->tage[i][idx[i]].ctr >= 0;
+      break;
+    }
+  }
+  pred = (provider >= 0) ? bp->tage[provider][idx[provider]].ctr >= 0 : altpred;
+
+  /* update */
+  if (provider >= 0) {
+    e = &bp->tage[provider][idx[provider]];
+    if (taken && e->ctr < 3)
+      e->ctr++;
+    else if (!taken && e->ctr > -4)
+      e->ctr--;
+    if (pred != altpred) {
+      if (pred == taken && e->useful < 3)
+        e->useful++;
+      else if (pred != taken && e->useful > 0)
+        e->useful--;
+    }
+  }
+  else
+    counterUpdate(&bp->bimodal[pc & ((1 << BPTABLEBITS) - 1)], taken);
+
+  /* on a mispredict, allocate an entry in a longer history table */
+  if (pred != taken) {
+    for (i = provider + 1; i < TAGETABLES; ++i) {
+      e = &bp->tage[i][idx[i]];
+      if (e->useful == 0) {
+        e->tag = tag[i];
+        e->ctr = taken ? 0 : -1;
+        break;
+      }
+    }
+    if (i == TAGETABLES) {
+      for (i = provider + 1; i < TAGETABLES; ++i)
+        if (bp->tage[i][idx[i]].useful > 0)
+          bp->tage[i][idx[i]].useful--;
+    }
+  }
+
+  return pred;
+}
+
+/*
+ * Predict and then train on one executed beq at pc, which went to target
+ * when taken. Returns 1 if it was mispredicted.
+ */
+int
+bpBranch(predictorType *bp, int pc, int taken, int target)
+{
+  unsigned int i = pc & ((1 << BPTABLEBITS) - 1);
+  unsigned int g = (pc ^ bp->history) & ((1 << BPTABLEBITS) - 1);
+  int b = pc & (BTBENTRIES - 1);
+  int btb_hit = (bp->btb_pc[b] == pc && bp->btb_target[b] == target);
+  int pred;
+  int p1;
+  int p2;
+
+  switch (bp->kind) {
+    case bp_nt:
+    default:
+      pred = false;
+      break;
+
+    case bp_btfn:
+      /* decided at decode from the offset, no BTB needed */
+      pred = (target <= pc);
+      btb_hit = true;
+      break;
+
+    case bp_bimodal:
+      pred = bp->bimodal[i] >= 2;
+      counterUpdate(&bp->bimodal[i], taken);
+      break;
+
+    case bp_gshare:
+      pred = bp->gshare[g] >= 2;
+      counterUpdate(&bp->gshare[g], taken);
+      break;
+
+    case bp_tournament:
+      p1 = bp->bimodal[i] >= 2;
+      p2 = bp->gshare[g] >= 2;
+      pred = (bp->chooser[i] >= 2) ? p2 : p1;
+      if (p1 != p2)
+        counterUpdate(&bp->chooser[i], p2 == taken);
+      counterUpdate(&bp->bimodal[i], taken);
+      counterUpdate(&bp->gshare[g], taken);
+      break;
+
+    case bp_tage:
+      pred = tagePredict(bp, pc, taken);
+      break;
+  }
+
+  bp->branches++;
+  bp->history = (bp->history << 1) | (taken != 0);
+
+  if (taken && pred && !btb_hit)
+    bp->btb_misses++;
+  if (taken) {
+    bp->btb_pc[b] = pc;
+    bp->btb_target[b] = target;
+  }
+
+  if (pred != taken || (taken && !btb_hit)) {
+    bp->mispredicts++;
+    return 1;
+  }
+  return 0;
+}
+
+void
+dramInit(dramType *d)
+{
+  int i;
+
+  d->bank = malloc(d->channels * d->banks * sizeof(dramBank));
+  d->bus = calloc(d->channels, sizeof(long long));
+  if (d->bank == NULL || d->bus == NULL) {
+    printf("error: can't allocate %d dram banks\n", d->channels * d->banks);
+    exit(1);
+  }
+  for (i = 0; i < d->channels * d->banks; ++i) {
+    d->bank[i].row = -1;
+    d->bank[i].ready = 0;
+  }
+  d->next_refresh = d->tREFI;
+}
+
+void
+dramRefresh(dramType *d, long long t)
+{
+  long long start;
+  int i;
+
+  while (d->tREFI && d->next_refresh <= t) {
+    for (i = 0; i < d->channels * d->banks; ++i) {
+      start = d->bank[i].ready > d->next_refresh ? d->bank[i].ready
+                                                  : d->next_refresh;
+      d->bank[i].ready = start + d->tRFC;
+      d->bank[i].row = -1;
+    }
+    d->next_refresh += d->tREFI;
+    d->refreshes++;
+  }
+}
+
+dramBank *
+dramBankOf(dramType *d, int addr, int *ch, int *row)
+{
+  int r = addr / d->row_words;
+
+  *ch = r % d->channels;
+  *row = r / d->channels / d->banks;
+  return &d->bank[*ch * d->banks + r / d->channels % d->banks];
+}
+
+/*
+ * Move words starting at addr, issued no earlier than cycle t, and return
+ * the cycle the last word is on the bus.
+ */
+long long
+dramAccess(dramType *d, int addr, int words, long long t)
+{
+  dramBank *b;
+  int ch;
+  int row;
+
+  dramRefresh(d, t);
+  b = dramBankOf(d, addr, &ch, &row);
+  if (b->ready > t)
+    t = b->ready;
+
+  if (b->row == row) {
+    d->row_hits++;
+    t += d->tCAS;
+  }
+  else if (b->row < 0) {
+    d->row_empty++;
+    t += d->tRCD + d->tCAS;
+  }
+  else {
+    d->row_conflicts++;
+    t += d->tRP + d->tRCD + d->tCAS;
+  }
+
+  if (d->bus[ch] > t)
+    t = d->bus[ch];
+  t += words * d->tBurst;
+  d->bus[ch] = t;
+
+  if (d->closed_page) {
+    b->row = -1;
+    b->ready = t + d->tRP;
+  }
+  else {
+    b->row = row;
+    b->ready = t;
+  }
+  return t;
+}
+
+/*
+ * Issue queued writebacks until at most keep are left, each time taking
+ * the oldest one whose row is open, or the oldest if none is.
+ */
+void
+dramDrain(dramType *d, int keep)
+{
+  int pick;
+  int ch;
+  int row;
+  int i;
+
+  while (d->queued > keep) {
+    for (pick = 0; pick < d->queued; ++pick) {
+      if (dramBankOf(d, d->queue[pick], &ch, &row)->row == row)
+        break;
+    }
+    if (pick == d->queued)
+      pick = 0;
+
+    dramAccess(d, d->queue[pick], d->queue_words[pick], d->now);
+    d->queued--;
+    for (i = pick; i < d->queued; ++i) {
+      d->queue[i] = d->queue[i + 1];
+      d->queue_words[i] = d->queue_words[i + 1];
+    }
+  }
+}
+
+void
+dramWrite(dramType *d, int addr, int words)
+{
+  if (d->queued == d->depth) {
+    d->drains++;
+    dramDrain(d, d->depth / 2);
+  }
+  d->writes++;
+  d->queue[d->queued] = addr;
+  d->queue_words[d->queued++] = words;
+}
+
+/*
+ * A fill: returns the cycles the processor waits for it.
+ */
+int
+dramRead(dramType *d, int addr, int words)
+{
+  long long done;
+  int i;
+
+  d->reads++;
+  done = d->now + words * d->tBurst;
+  for (i = 0; i < d->queued; ++i) {
+    if (addr >= d->queue[i] && addr < d->queue[i] + d->queue_words[i])
+      break;
+  }
+  if (i < d->queued)
+    d->forwarded++;
+  else
+    done = dramAccess(d, addr, words, d->now);
+
+  d->stall += done - d->now;
+  i = done - d->now;
+  d->now = done;
+  return i;
+}
+
+/*
+ * Cycles a miss holds the pipeline up: the fixed -pm penalty, or with -d
+ * the time spent waiting on its fills.
+ */
+int
+missPenalty(int missed, long long stall)
+{
+  if (!missed)
+    return 0;
+  return DRAM.enabled ? stall : PIPE.miss_penalty;
+}
+
+void
+tlbInit(tlbType *tlb)
+{
+  int i;
+
+  tlb->entry = malloc(tlb->entries * sizeof(tlbEntry));
+  if (tlb->entry == NULL) {
+    printf("error: can't allocate a %d entry TLB\n", tlb->entries);
+    exit(1);
+  }
+  for (i = 0; i < tlb->entries; ++i)
+    tlb->entry[i].vpn = -1;
+}
+
+tlbEntry *
+tlbLookup(tlbType *tlb, int vpn)
+{
+  tlbEntry *set = &tlb->entry[vpn % (tlb->entries / tlb->ways) * tlb->ways];
+  int i;
+
+  for (i = 0; i < tlb->ways; ++i) {
+    if (set[i].vpn == vpn) {
+      set[i].used = VM.clock;
+      tlb->hits++;
+      return &set[i];
+    }
+  }
+  tlb->misses++;
+  return NULL;
+}
+
+void
+tlbInsert(tlbType *tlb, int vpn, int frame)
+{
+  tlbEntry *set = &tlb->entry[vpn % (tlb->entries / tlb->ways) * tlb->ways];
+  int victim = 0;
+  int i;
+
+  for (i = 0; i < tlb->ways && set[i].vpn >= 0; ++i) {
+    if (VM.policy == tlb_lru && set[i].used < set[victim].used)
+      victim = i;
+    else if (VM.policy == tlb_fifo && set[i].filled < set[victim].filled)
+      victim = i;
+  }
+  if (i < tlb->ways)
+    victim = i;
+  else if (VM.policy == tlb_random) {
+    VM.seed = VM.seed * 1103515245 + 12345;
+    victim = (VM.seed >> 16) % tlb->ways;
+  }
+
+  set[victim].vpn = vpn;
+  set[victim].frame = frame;
+  set[victim].used = VM.clock;
+  set[victim].filled = VM.clock;
+}
+
+/*
+ * Table index of virtual page vpn at level l, 0 being the root.
+ */
+int
+vmIndex(vmType *vm, int vpn, int l)
+{
+  return (vpn >> (vm->index_bits * (vm->walk_levels - 1 - l))) &
+         ((1 << vm->index_bits) - 1);
+}
+
+/*
+ * Lay out physical memory as the frames followed by the page tables,
+ * then map every page of the words of virtual memory.
+ */
+void
+vmInit(vmType *vm, stateType *state, int words)
+{
+  long long phys;
+  long long covered;
+  int *order;
+  int frames;
+  int table;
+  int vpn_bits;
+  int page_bits;
+  int next;
+  int base;
+  int pte;
+  int v;
+  int l;
+  int t;
+
+  for (page_bits = 0; (1 << page_bits) < vm->page_words; ++page_bits)
+    ;
+  for (vpn_bits = 0; ((long long)vm->page_words << vpn_bits) < words; ++vpn_bits)
+    ;
+  vm->size = words;
+  vm->index_bits = (vpn_bits + vm->levels - 1) / vm->levels;
+  if (vm->index_bits == 0)
+    vm->index_bits = 1;
+  vm->walk_levels = vm->levels - vm->huge;
+  vm->unit_bits = page_bits + (vm->huge ? vm->index_bits : 0);
+  table = 1 << vm->index_bits;
+  frames = (words + (1 << vm->unit_bits) - 1) >> vm->unit_bits;
+
+  /* a table at level l covers table^(walk_levels - l) frames */
+  phys = (long long)frames << vm->unit_bits;
+  for (l = 0; l < vm->walk_levels; ++l) {
+    for (covered = 1, t = l; t < vm->walk_levels && covered < frames; ++t)
+      covered *= table;
+    phys += (frames + covered - 1) / covered * table;
+  }
+  if (phys > INT_MAX) {
+    printf("error: %lld words of physical memory are too many\n", phys);
+    exit(1);
+  }
+  initMemory(state, phys);
+
+  order = malloc(frames * sizeof(int));
+  if (order == NULL) {
+    printf("error: can't allocate %d frames\n", frames);
+    exit(1);
+  }
+  for (v = 0; v < frames; ++v)
+    order[v] = v;
+  for (v = frames - 1; vm->random_frames && v > 0; --v) {
+    vm->seed = vm->seed * 1103515245 + 12345;
+    t = (vm->seed >> 8) % (v + 1);
+    l = order[v];
+    order[v] = order[t];
+    order[t] = l;
+  }
+
+  vm->root = frames << vm->unit_bits;
+  next = vm->root + table;
+  for (v = 0; v < frames; ++v) {
+    base = vm->root;
+    for (l = 0; l < vm->walk_levels - 1; ++l) {
+      pte = memRead(state, base + vmIndex(vm, v, l));
+      if (pte == 0) {
+        pte = next + 1;
+        next += table;
+        memWrite(state, base + vmIndex(vm, v, l), pte);
+      }
+      base = pte - 1;
+    }
+    memWrite(state, base + vmIndex(vm, v, l), (order[v] << vm->unit_bits) + 1);
+  }
+  free(order);
+
+  tlbInit(&vm->l1);
+  tlbInit(&vm->l2);
+}
+
+/*
+ * Physical address of virtual address addr, read straight from the page
+ * table without touching the cache or the TLBs.
+ */
+int
+vmPhys(stateType *state, int addr)
+{
+  int base = VM.root;
+  int l;
+
+  if (!VM.enabled)
+    return addr;
+  for (l = 0; l < VM.walk_levels; ++l)
+    base = memRead(state, base + vmIndex(&VM, addr >> VM.unit_bits, l)) - 1;
+  return base + (addr & ((1 << VM.unit_bits) - 1));
+}
+
+/*
+ * Walk the page table for vpn through the data cache, returning the
+ * physical address of its frame.
+ */
+int
+vmWalk(stateType *state, int vpn)
+{
+  long long misses;
+  long long dram;
+  int cycles;
+  int base = VM.root;
+  int pte;
+  int l;
+
+  VM.walks++;
+  VM.walking = true;
+  for (l = 0; l < VM.walk_levels; ++l) {
+    misses = STATS.misses[load];
+    dram = DRAM.stall;
+    pte = cache_op(load, base + vmIndex(&VM, vpn, l), 0, state);
+
+    cycles = 1;
+    if (STATS.misses[load] != misses) {
+      VM.walk_misses++;
+      cycles += DRAM.enabled ? DRAM.stall - dram : PIPE.miss_penalty;
+    }
+    VM.walk_dram += DRAM.stall - dram;
+    VM.walk_accesses++;
+    VM.walk_cycles += cycles;
+    VM.stall += cycles;
+
+    if (pte == 0) {
+      printf("error: page fault on virtual page %d\n", vpn);
+      exit(1);
+    }
+    base = pte - 1;
+  }
+  VM.walking = false;
+  return base;
+}
+
+int
+vmTranslate(stateType *state, int addr)
+{
+  tlbEntry *e;
+  int vpn = addr >> VM.unit_bits;
+  int frame;
+
+  if (addr < 0 || addr >= VM.size) {
+    printf("error: virtual address %d out of range\n", addr);
+    exit(1);
+  }
+
+  VM.clock++;
+  if (!VM.vipt)
+    VM.stall += VM.l1.latency;
+  if ( (e = tlbLookup(&VM.l1, vpn)) != NULL )
+    return e->frame + (addr & ((1 << VM.unit_bits) - 1));
+
+  VM.stall += VM.l2.latency;
+  if ( (e = tlbLookup(&VM.l2, vpn)) != NULL )
+    frame = e->frame;
+  else {
+    frame = vmWalk(state, vpn);
+    tlbInsert(&VM.l2, vpn, frame);
+  }
+  tlbInsert(&VM.l1, vpn, frame);
+  return frame + (addr & ((1 << VM.unit_bits) - 1));
+}
+
+void
+printTlb(FILE *out, char *name, tlbType *tlb)
+{
+  fprintf(out, "      \"%s\": { \"entries\": %d, \"ways\": %d, \"hits\": %lld, "
+          "\"misses\": %lld },\n",
+          name, tlb->entries, tlb->ways, tlb->hits, tlb->misses);
+}
+
+void
+printVm(FILE *out)
+{
+  static const char *policy_names[3] = { "lru", "fifo", "random" };
+
+  fprintf(out, ",\n    \"vm\": {\n");
+  fprintf(out, "      \"page_words\": %d,\n", 1 << VM.unit_bits);
+  fprintf(out, "      \"huge_pages\": %s,\n", VM.huge ? "true" : "false");
+  fprintf(out, "      \"levels\": %d,\n", VM.walk_levels);
+  fprintf(out, "      \"cache\": \"%s\",\n", VM.vipt ? "vipt" : "pipt");
+  fprintf(out, "      \"tlb_policy\": \"%s\",\n", policy_names[VM.policy]);
+  printTlb(out, "l1_tlb", &VM.l1);
+  printTlb(out, "l2_tlb", &VM.l2);
+  fprintf(out, "      \"walks\": %lld,\n", VM.walks);
+  fprintf(out, "      \"walk_accesses\": %lld,\n", VM.walk_accesses);
+  fprintf(out, "      \"walk_misses\": %lld,\n", VM.walk_misses);
+  fprintf(out, "      \"walk_cycles\": %lld,\n", VM.walk_cycles);
+  fprintf(out, "      \"translation_cycles\": %lld\n", VM.stall);
+  fprintf(out, "    }");
+}
+
+void
+pipeInit(pipeType *p)
+{
+  int i;
+
+  for (i = 0; i < NUMSTAGES; ++i)
+    p->ent[i] = -1;
+  for (i = 0; i < NUMREGS; ++i)
+    p->ready[i] = 0;
+  p->redirect = 0;
+}
+
+/*
+ * Time one instruction through the pipeline. imiss and dmiss are the
+ * cycles its fetch and its lw/sw were held up by cache misses, mispredict
+ * says whether the instructions fetched after a beq had to be thrown away.
+ */
+void
+pipeStep(pipeType *p, int opcode, int regA, int regB, int destR,
+    int mispredict, int imiss, int dmiss)
+{
+  long long ent[NUMSTAGES];
+  int lat[NUMSTAGES];
+  long long own[NUMSTALLS];
+  long long need;
+  long long gap;
+  int use_stage;
+  int load_use;
+  int srcs[2];
+  int nsrc;
+  int dst;
+  int s;
+  int i;
+
+  memset(own, 0, sizeof(own));
+  for (s = 0; s < NUMSTAGES; ++s)
+    lat[s] = 1;
+
+  lat[IF] += imiss;
+  own[stall_icache] += imiss;
+  lat[MEM] += dmiss;
+  own[stall_dcache] += dmiss;
+
+  /* registers read and written */
+  nsrc = 0;
+  dst = -1;
+  if (opcode == add || opcode == nand || opcode == cmov) {
+    srcs[nsrc++] = regA;
+    srcs[nsrc++] = regB;
+    dst = destR;
+  }
+  else if (opcode == lw) {
+    srcs[nsrc++] = regA;
+    dst = regB;
+  }
+  else if (opcode == sw || opcode == beq) {
+    srcs[nsrc++] = regA;
+    srcs[nsrc++] = regB;
+  }
+
+  /* operands are needed entering EX, or ID for a beq resolved there */
+  need = 0;
+  load_use = false;
+  for (i = 0; i < nsrc; ++i) {
+    if (srcs[i] != 0 && p->ready[srcs[i]] > need) {
+      need = p->ready[srcs[i]];
+      load_use = p->from_load[srcs[i]];
+    }
+  }
+  use_stage = EX;
+  if (opcode == beq && p->resolve_stage == ID)
+    use_stage = ID;
+
+  ent[IF] = p->ent[ID];
+  if (p->redirect > ent[IF]) {
+    own[stall_branch] += p->redirect - ent[IF];
+    ent[IF] = p->redirect;
+  }
+
+  for (s = ID; s < NUMSTAGES; ++s) {
+    ent[s] = ent[s - 1] + lat[s - 1];
+    if (s < WB && p->ent[s + 1] > ent[s])
+      ent[s] = p->ent[s + 1];
+    if (s == WB && p->ent[WB] + 1 > ent[s])
+      ent[s] = p->ent[WB] + 1;
+
+    if (s == use_stage && need > ent[s]) {
+      own[(load_use && p->forwarding) ? stall_load_use : stall_raw] += need - ent[s];
+      ent[s] = need;
+    }
+  }
+
+  if (dst > 0) {
+    if (!p->forwarding)
+      p->ready[dst] = ent[WB] + 1;
+    else if (opcode == lw)
+      p->ready[dst] = ent[MEM] + lat[MEM];
+    else
+      p->ready[dst] = ent[EX] + lat[EX];
+    p->from_load[dst] = (opcode == lw);
+  }
+
+  if (opcode == beq && mispredict) {
+    p->redirect = ent[p->resolve_stage] + lat[p->resolve_stage] + p->flush_penalty;
+    p->flushes++;
+  }
+
+  /*
+   * Charge the cycles between this instruction's writeback and the
+   * previous one's to whatever held this instruction up.
+   */
+  gap = (p->instrs == 0) ? ent[WB] - WB : ent[WB] - p->ent[WB] - 1;
+  for (i = 0; i < NUMSTALLS && gap > 0; ++i) {
+    if (own[i] > gap)
+      own[i] = gap;
+    p->stalls[i] += own[i];
+    gap -= own[i];
+  }
+  p->stalls[stall_structural] += gap;
+
+  memcpy(p->ent, ent, sizeof(ent));
+  p->instrs++;
+  p->cycles = ent[WB] + 1;
+}
+
+void
+printStatsFields(FILE *out, const char *indent)
+{
+  static const char *op_names[8] =
+      { "add", "nand", "lw", "sw", "beq", "cmov", "halt", "noop" };
+  static const char *access_names[3] = { "fetch", "sw", "lw" };
+  int i;
+
+  fprintf(out, "%s\"instructions\": %lld,\n", indent, STATS.instrs);
+  fprintf(out, "%s\"opcodes\": {", indent);
+  for (i = 0; i < 8; ++i)
+    fprintf(out, "%s\"%s\": %lld", i ? ", " : " ", op_names[i], STATS.opcodes[i]);
+  fprintf(out, " },\n");
+  fprintf(out, "%s\"beq\": { \"taken\": %lld, \"not_taken\": %lld },\n",
+          indent, STATS.beq_taken, STATS.beq_not_taken);
+  fprintf(out, "%s\"loads\": %lld,\n", indent, STATS.loads);
+  fprintf(out, "%s\"stores\": %lld,\n", indent, STATS.stores);
+  fprintf(out, "%s\"cache\": {", indent);
+  for (i = 0; i < 3; ++i)
+    fprintf(out, "%s\"%s\": { \"hits\": %lld, \"misses\": %lld }",
+            i ? ", " : " ", access_names[i], STATS.hits[i], STATS.misses[i]);
+  fprintf(out, " },\n");
+  fprintf(out, "%s\"evictions\": %lld,\n", indent, STATS.evictions);
+  fprintf(out, "%s\"writebacks\": %lld,\n", indent, STATS.writebacks);
+  fprintf(out, "%s\"sector_misses\": %lld,\n", indent, STATS.sector_misses);
+  fprintf(out, "%s\"memory_words\": { \"read\": %lld, \"written\": %lld }",
+          indent, STATS.mem_reads, STATS.mem_writes);
+}
+
+/*
+ * The stats file is a single JSON object. Interval samples are appended to
+ * its "samples" array while the program runs, the totals go in "final".
+ */
+void
+printStatsSample(FILE *out, int first)
+{
+  fprintf(out, "%s    {\n", first ? "" : ",\n");
+  printStatsFields(out, "      ");
+  fprintf(out, "\n    }");
+  fflush(out);
+}
+
+/*
+ * Coherence counters for the multicore mode, with each core's own
+ * counters.
+ */
+void
+printMulticore(FILE *out)
+{
+  statsType total = STATS;
+  coreType *core;
+  long long bus[3] = { 0, 0, 0 };
+  long long words = 0;
+  int b_size = MULTI.core[0].state.b_size;
+
+  for (core = MULTI.core; core < MULTI.core + MULTI.cores; ++core) {
+    bus[bus_rd] += core->bus[bus_rd];
+    bus[bus_rdx] += core->bus[bus_rdx];
+    bus[bus_upgr] += core->bus[bus_upgr];
+    words += core->stats.mem_reads + core->stats.mem_writes +
+             (core->supplies + core->flushes) * b_size;
+  }
+
+  fprintf(out, ",\n    \"multicore\": {\n");
+  fprintf(out, "      \"protocol\": \"%s\",\n", MULTI.moesi ? "moesi" : "mesi");
+  fprintf(out, "      \"quantum\": %d,\n", MULTI.quantum);
+  fprintf(out, "      \"quanta\": %lld,\n", MULTI.quanta);
+  fprintf(out, "      \"bus\": { \"rd\": %lld, \"rdx\": %lld, \"upgr\": %lld, "
+          "\"words\": %lld },\n", bus[bus_rd], bus[bus_rdx], bus[bus_upgr], words);
+  fprintf(out, "      \"cores\": [");
+  for (core = MULTI.core; core < MULTI.core + MULTI.cores; ++core) {
+    fprintf(out, "%s\n        {\n", core == MULTI.core ? "" : ",");
+    STATS = core->stats;
+    printStatsFields(out, "          ");
+    fprintf(out, ",\n          \"bus\": { \"rd\": %lld, \"rdx\": %lld, \"upgr\": %lld },\n",
+            core->bus[bus_rd], core->bus[bus_rdx], core->bus[bus_upgr]);
+    fprintf(out, "          \"invalidations\": %lld,\n", core->invalidations);
+    fprintf(out, "          \"coherence_misses\": %lld,\n", core->coherence_misses);
+    fprintf(out, "          \"supplies\": %lld,\n", core->supplies);
+    fprintf(out, "          \"flushes\": %lld\n        }", core->flushes);
+  }
+  fprintf(out, "\n      ]\n    }");
+  STATS = total;
+}
+
+/*
+ * Per program counters for the multi-program mode.
+ */
+void
+printPrograms(FILE *out)
+{
+  static const char *sched_names[3] = { "rr", "random", "miss" };
+  statsType total = STATS;
+  progType *p;
+  int k;
+
+  fprintf(out, ",\n    \"programs\": {\n");
+  fprintf(out, "      \"schedule\": \"%s\",\n", sched_names[MP.schedule]);
+  fprintf(out, "      \"slice\": %d,\n", MP.slice);
+  fprintf(out, "      \"partition\": \"%s\",\n",
+          MP.quota == NULL ? "none" : MP.ucp ? "ucp" : "static");
+  fprintf(out, "      \"repartitions\": %lld,\n", MP.repartitions);
+  fprintf(out, "      \"list\": [");
+  for (k = 0; k < MP.count; ++k) {
+    p = &MP.prog[k];
+    fprintf(out, "%s\n        {\n", k ? "," : "");
+    fprintf(out, "          \"name\": \"%s\",\n", p->name);
+    if (MP.quota != NULL)
+      fprintf(out, "          \"ways\": %d,\n", MP.quota[k]);
+    STATS = p->stats;
+    printStatsFields(out, "          ");
+    fprintf(out, ",\n          \"evicted_others\": %lld,\n", p->evicted_others);
+    fprintf(out, "          \"evicted_by_others\": %lld\n        }",
+            p->evicted_by_others);
+  }
+  fprintf(out, "\n      ]\n    }");
+  STATS = total;
+}
+
+void
+printStatsFinal(FILE *out, int n_sets)
+{
+  int i;
+
+  fprintf(out, "\n  ],\n  \"final\": {\n");
+  printStatsFields(out, "    ");
+  fprintf(out, ",\n    \"set_conflicts\": [");
+  for (i = 0; i < n_sets; ++i)
+    fprintf(out, "%s%lld", i ? ", " : " ", STATS.set_conflicts[i]);
+  fprintf(out, " ]");
+
+  fprintf(out, ",\n    \"branch_predictor\": {\n");
+  fprintf(out, "      \"kind\": \"%s\",\n", bp_names[BP.kind]);
+  fprintf(out, "      \"branches\": %lld,\n", BP.branches);
+  fprintf(out, "      \"mispredicts\": %lld,\n", BP.mispredicts);
+  fprintf(out, "      \"mpki\": %.4f,\n",
+          STATS.instrs ? 1000.0 * BP.mispredicts / STATS.instrs : 0.0);
+  fprintf(out, "      \"btb_misses\": %lld,\n", BP.btb_misses);
+  fprintf(out, "      \"penalty_cycles\": %lld\n",
+          PIPE.enabled ? PIPE.stalls[stall_branch] : BP.mispredicts * BP.penalty);
+  fprintf(out, "    }");
+
+  if (MULTI.cores > 1)
+    printMulticore(out);
+
+  if (MP.count > 1)
+    printPrograms(out);
+
+  if (MIN.block != NULL)
+    printBelady(out);
+
+  if (VM.enabled)
+    printVm(out);
+
+  if (ENERGY.enabled)
+    printEnergy(out);
+
+  if (ZIP.factor)
+    printZip(out);
+
+  if (DRAM.enabled) {
+    fprintf(out, ",\n    \"dram\": {\n");
+    fprintf(out, "      \"channels\": %d,\n", DRAM.channels);
+    fprintf(out, "      \"banks\": %d,\n", DRAM.banks);
+    fprintf(out, "      \"row_words\": %d,\n", DRAM.row_words);
+    fprintf(out, "      \"page_policy\": \"%s\",\n", DRAM.closed_page ? "closed" : "open");
+    fprintf(out, "      \"reads\": %lld,\n", DRAM.reads);
+    fprintf(out, "      \"writes\": %lld,\n", DRAM.writes);
+    fprintf(out, "      \"forwarded_reads\": %lld,\n", DRAM.forwarded);
+    fprintf(out, "      \"row_hits\": %lld,\n", DRAM.row_hits);
+    fprintf(out, "      \"row_empty\": %lld,\n", DRAM.row_empty);
+    fprintf(out, "      \"row_conflicts\": %lld,\n", DRAM.row_conflicts);
+    fprintf(out, "      \"refreshes\": %lld,\n", DRAM.refreshes);
+    fprintf(out, "      \"write_drains\": %lld,\n", DRAM.drains);
+    fprintf(out, "      \"stall_cycles\": %lld,\n", DRAM.stall);
+    fprintf(out, "      \"cycles\": %lld\n", DRAM.now);
+    fprintf(out, "    }");
+  }
+
+  if (PIPE.enabled) {
+    fprintf(out, ",\n    \"pipeline\": {\n");
+    fprintf(out, "      \"cycles\": %lld,\n", PIPE.cycles);
+    fprintf(out, "      \"cpi\": %.4f,\n",
+            PIPE.instrs ? (double)PIPE.cycles / PIPE.instrs : 0.0);
+    fprintf(out, "      \"flushes\": %lld,\n", PIPE.flushes);
+    fprintf(out, "      \"stalls\": { \"icache\": %lld, \"dcache\": %lld, "
+            "\"load_use\": %lld, \"raw\": %lld, \"branch\": %lld, "
+            "\"structural\": %lld }\n",
+            PIPE.stalls[stall_icache], PIPE.stalls[stall_dcache],
+            PIPE.stalls[stall_load_use], PIPE.stalls[stall_raw],
+            PIPE.stalls[stall_branch], PIPE.stalls[stall_structural]);
+    fprintf(out, "    }");
+  }
+
+  fprintf(out, "\n  }\n}\n");
+}
+
+/*
+ * atexit handler. A run that stops on an error never gets to write
+ * "final", so close the file here with the counters so far and "error"
+ * set, and it still parses.
+ */
+void
+statsAbort(void)
+{
+  if (STATS_OUT == NULL)
+    return;
+
+  fprintf(STATS_OUT, "\n  ],\n  \"error\": true,\n  \"final\": {\n");
+  printStatsFields(STATS_OUT, "    ");
+  fprintf(STATS_OUT, "\n  }\n}\n");
+  fclose(STATS_OUT);
+  STATS_OUT = NULL;
+}
+
+/*
+ * MIN misses next to those of the cache that was run, leaving out misses
+ * on a resident block of a sectored cache since MIN works on whole blocks.
+ */
+void
+printBelady(FILE *out)
+{
+  static const char *access_names[3] = { "fetch", "sw", "lw" };
+  long long lru = -STATS.sector_misses;
+  long long opt = 0;
+  int i;
+
+  for (i = 0; i < 3; ++i) {
+    lru += STATS.misses[i];
+    opt += MIN.misses[i];
+  }
+  fprintf(out, ",\n    \"belady\": {\n");
+  fprintf(out, "      \"accesses\": %d,\n", MIN.n);
+  fprintf(out, "      \"misses\": %lld,\n", opt);
+  for (i = 0; i < 3; ++i)
+    fprintf(out, "      \"%s_misses\": %lld,\n", access_names[i], MIN.misses[i]);
+  fprintf(out, "      \"policy\": \"%s\",\n", MP.quota != NULL ? "lru partitioned" : "lru");
+  fprintf(out, "      \"policy_misses\": %lld,\n", lru);
+  fprintf(out, "      \"excess_misses\": %lld\n", lru - opt);
+  fprintf(out, "    }");
+}
+
+/*
+ * Bits needed to tell apart n things.
+ */
+int
+bitsFor(int n)
+{
+  int bits;
+
+  for (bits = 0; (1 << bits) < n; ++bits)
+    ;
+  return bits;
+}
+
+void
+energyRun(energyType *e, stateType *state, int mem_words)
+{
+  double row_pj;
+  double seconds;
+  long long lookups = 0;
+  long long sector_ops;
+  long long acts;
+  int sectors = state->b_size / state->sec_size;
+  int data_ways = state->bps;
+  int i;
+
+  e->tag_bits = bitsFor(mem_words) - bitsFor(state->n_sets) -
+                bitsFor(state->b_size);
+  if (e->tag_bits < 0)
+    e->tag_bits = 0;
+  e->tag_bits += 2 * sectors + bitsFor(state->bps);
+  if (ZIP.factor) {
+    data_ways = ZIP.ways;
+    e->tag_bits += 3 + bitsFor(state->b_size + 1); /* scheme and size */
+  }
+  e->bits = (long long)state->n_sets *
+            (state->bps * e->tag_bits + data_ways * 32 * state->b_size);
+  e->area = e->bits * e->bit_area / 1e6;
+
+  for (i = 0; i < 3; ++i)
+    lookups += STATS.hits[i] + STATS.misses[i];
+
+  e->cycles = STATS.instrs ? STATS.instrs : lookups;
+  if (PIPE.enabled)
+    e->cycles = PIPE.cycles;
+  else {
+    e->cycles += BP.mispredicts * BP.penalty;
+    e->cycles += DRAM.enabled ? DRAM.stall :
+                 (STATS.misses[fetch] + STATS.misses[load] +
+                  STATS.misses[store]) * PIPE.miss_penalty;
+    if (VM.enabled)
+      e->cycles += VM.stall;
+  }
+  seconds = e->cycles / (e->ghz * 1e9);
+
+  row_pj = e->bit_read * (0.5 + 0.5 * sqrt(state->n_sets / 64.0));
+  e->tag = lookups * row_pj * e->tag_bits * state->bps;
+  sector_ops = (STATS.mem_reads + STATS.mem_writes) / state->sec_size;
+  e->data = (lookups + sector_ops) * row_pj * 32 * state->b_size * data_ways;
+  e->leak = e->bits * e->bit_leak * seconds;
+
+  acts = DRAM.enabled ? DRAM.row_empty + DRAM.row_conflicts : sector_ops;
+  e->dram = acts * e->dram_act +
+            (STATS.mem_reads + STATS.mem_writes) * e->dram_word;
+}
+
+double
+energyTotal(energyType *e)
+{
+  return e->tag + e->data + e->leak + e->dram;
+}
+
+void
+printEnergy(FILE *out)
+{
+  double total = energyTotal(&ENERGY);
+  double seconds = ENERGY.cycles / (ENERGY.ghz * 1e9);
+
+  fprintf(out, ",\n    \"energy\": {\n");
+  fprintf(out, "      \"cache_bits\": %lld,\n", ENERGY.bits);
+  fprintf(out, "      \"area_mm2\": %.6f,\n", ENERGY.area);
+  fprintf(out, "      \"cycles\": %lld,\n", ENERGY.cycles);
+  fprintf(out, "      \"tag_pj\": %.1f,\n", ENERGY.tag);
+  fprintf(out, "      \"data_pj\": %.1f,\n", ENERGY.data);
+  fprintf(out, "      \"leakage_pj\": %.1f,\n", ENERGY.leak);
+  fprintf(out, "      \"dram_pj\": %.1f,\n", ENERGY.dram);
+  fprintf(out, "      \"total_pj\": %.1f,\n", total);
+  fprintf(out, "      \"edp_js\": %.6e,\n", total * 1e-12 * seconds);
+  fprintf(out, "      \"mips_per_watt\": %.1f\n",
+          total > 0 ? STATS.instrs / (total * 1e-12) / 1e6 : 0.0);
+  fprintf(out, "    }");
+}
+
+void
+printState(stateType *statePtr)
+{
+  int i;
+  printf("\n@@@\nstate:\n");
+  printf("\tpc %d\n", statePtr->pc);
+  printf("\tmemory:\n");
+
+  for (i=0; i<statePtr->numMemory; i++) {
+    printf("\t\tmem[ %d ] %d\n", i, memRead(statePtr, vmPhys(statePtr, i)));
+  }
+  printf("\tregisters:\n");
+
+  for (i=0; i<NUMREGS; i++) {
+    printf("\t\treg[ %d ] %d\n", i, statePtr->reg[i]);
+  }
+  printf("end state\n");
+}
+
+void
+printCache(stateType *state, int num_sets, int b_size, int bps) {
+  printf("cache\n");
+  int i;
+  int j;
+  int k;
+  for (i = 0; i < num_sets; ++i) {
+    printf("\tcache set %d\n", i);
+    for (k = 0; k < bps; ++k) {
+      printf("\t\tdirty: %d  block #%d\n", state->CACHE[i].blocks[k].dirty, k);
+      for (j = 0; j < b_size; ++j) {
+        printf("\t\t\tblock");
+        printf("[%d] = %d\n", j, state->CACHE[i].blocks[k].lines[j]);
+      }
+    }
+  }
+  printf("\n\n");
+}
+
+void
+dumpOpen(dumpType *dump, stateType *state, char *name)
+{
+  int chunks = (state->memSize + DUMPCHUNK - 1) >> DUMPCHUNKBITS;
+
+  dump->file = fopen(name, "w");
+  if (dump->file == NULL) {
+    printf("error: can't open dump file %s", name);
+    perror("fopen");
+    exit(1);
+  }
+  dump->shadow = calloc(state->numPages, sizeof(int *));
+  dump->written = calloc(chunks, 1);
+  dump->chunks = malloc(chunks * sizeof(int));
+  dump->blocks = malloc(state->n_sets * state->bps * sizeof(cache_block *));
+  if (dump->shadow == NULL || dump->written == NULL || dump->chunks == NULL ||
+      dump->blocks == NULL) {
+    printf("error: can't allocate dump tables\n");
+    exit(1);
+  }
+}
+
+/*
+ * The chunk holding addr was written.
+ */
+void
+dumpMem(dumpType *dump, int addr)
+{
+  dump->written[addr >> DUMPCHUNKBITS] = true;
+  dump->chunks[dump->n_chunks++] = addr >> DUMPCHUNKBITS;
+}
+
+/*
+ * blk's tag, valid or dirty bits or data changed.
+ */
+void
+dumpBlock(dumpType *dump, cache_block *blk)
+{
+  blk->changed = true;
+  dump->blocks[dump->n_blocks++] = blk;
+}
+
+void
+dumpCacheBlock(FILE *out, stateType *state, cache_block *blk, int first)
+{
+  int set_index;
+  int tag;
+  int offset;
+  int i;
+
+  splitAddr(state, blk->mem_head, &set_index, &tag, &offset);
+  fprintf(out, "%s{\"set\": %d, \"way\": %d, \"valid\": %d", first ? "" : ", ",
+          set_index, (int)(blk - state->CACHE[set_index].blocks), blk->valid);
+  if (blk->valid) {
+    fprintf(out, ", \"tag\": %d, \"dirty\": %d, \"lines\": [", blk->tag,
+            blk->dirty);
+    for (i = 0; i < state->b_size; ++i)
+      fprintf(out, "%s%d", i ? ", " : "", blk->lines[i]);
+    fprintf(out, "]");
+  }
+  fprintf(out, "}");
+}
+
+/*
+ * Write pc, registers, memory words and cache blocks that changed since
+ * the last dump, all of them the first time. Memory addresses are
+ * physical, the same as the cache's.
+ */
+void
+dumpState(dumpType *dump, stateType *state, long long instrs)
+{
+  FILE *out = dump->file;
+  int full = (dump->dumps++ == 0);
+  int first;
+  int *page;
+  int *shadow;
+  int base;
+  int end;
+  int c;
+  int i;
+  int j;
+
+  fprintf(out, "{\"instrs\": %lld, %s\"pc\": %d, \"regs\": [", instrs,
+          full ? "\"full\": true, " : "", state->pc);
+  for (first = true, i = 0; i < NUMREGS; ++i) {
+    if (full || state->reg[i] != dump->reg[i]) {
+      fprintf(out, "%s[%d, %d]", first ? "" : ", ", i, state->reg[i]);
+      dump->reg[i] = state->reg[i];
+      first = false;
+    }
+  }
+
+  fprintf(out, "], \"mem\": [");
+  first = true;
+  if (full) {
+    for (i = 0; i < state->numPages; ++i) {
+      if (state->pages[i] == NULL)
+        continue;
+      for (j = 0; j < PAGESIZE; ++j) {
+        if (state->pages[i][j] != 0) {
+          fprintf(out, "%s[%d, %d]", first ? "" : ", ", (i << PAGESHIFT) + j,
+                  state->pages[i][j]);
+          first = false;
+        }
+      }
+      dump->shadow[i] = malloc(PAGESIZE * sizeof(int));
+      if (dump->shadow[i] == NULL) {
+        printf("error: can't allocate dump page\n");
+        exit(1);
+      }
+      memcpy(dump->shadow[i], state->pages[i], PAGESIZE * sizeof(int));
+    }
+  }
+  for (c = 0; c < dump->n_chunks; ++c) {
+    base = dump->chunks[c] << DUMPCHUNKBITS;
+    dump->written[dump->chunks[c]] = false;
+    if (full)
+      continue;
+    page = state->pages[base >> PAGESHIFT];
+    shadow = dump->shadow[base >> PAGESHIFT];
+    if (shadow == NULL) {
+      shadow = dump->shadow[base >> PAGESHIFT] = calloc(PAGESIZE, sizeof(int));
+      if (shadow == NULL) {
+        printf("error: can't allocate dump page\n");
+        exit(1);
+      }
+    }
+    end = base + DUMPCHUNK;
+    if (end > state->memSize)
+      end = state->memSize;
+    for (i = base & (PAGESIZE - 1), j = base; j < end; ++i, ++j) {
+      if (page[i] != shadow[i]) {
+        fprintf(out, "%s[%d, %d]", first ? "" : ", ", j, page[i]);
+        shadow[i] = page[i];
+        first = false;
+      }
+    }
+  }
+  dump->n_chunks = 0;
+
+  fprintf(out, "], \"cache\": [");
+  first = true;
+  if (full) {
+    for (i = 0; i < state->n_sets; ++i) {
+      for (j = 0; j < state->bps; ++j) {
+        if (state->CACHE[i].blocks[j].valid) {
+          dumpCacheBlock(out, state, &state->CACHE[i].blocks[j], first);
+          first = false;
+        }
+      }
+    }
+  }
+  for (i = 0; i < dump->n_blocks; ++i) {
+    if (!full)
+      dumpCacheBlock(out, state, dump->blocks[i], i == 0);
+    dump->blocks[i]->changed = false;
+  }
+  dump->n_blocks = 0;
+  fprintf(out, "]}\n");
+}
+
+/*
+ * Profiler.
+ */
+void
+profInit(profileType *prof, int size, char *name)
+{
+  prof->size = size;
+  prof->pc = calloc(size, sizeof(profEntry));
+  prof->line = calloc(size, sizeof(int));
+  prof->label = calloc(size, sizeof(char *));
+  prof->leader = calloc(size, sizeof(int));
+  if (prof->pc == NULL || prof->line == NULL || prof->label == NULL ||
+      prof->leader == NULL) {
+    printf("error: can't allocate profile for %d words\n", size);
+    exit(1);
+  }
+
+  prof->name = strrchr(name, '/') ? strrchr(name, '/') + 1 : name;
+}
 
-typedef struct stateStruct {
-  int pc;
-  int mem[NUMMEMORY];
-  int reg[NUMREGS];
-  int numMemory;
+void
+profSymbols(profileType *prof, char *symName)
+{
+  char line[MAXLINELENGTH];
+  char label[MAXLINELENGTH];
+  FILE *symFile;
+  int addr;
+  int src;
+  int n;
 
-  cache_set *CACHE;
-} stateType;
+  symFile = fopen(symName, "r");
+  if (symFile == NULL) {
+    printf("error: can't open symbol file %s", symName);
+    perror("fopen");
+    exit(1);
+  }
 
-int comp (const cache_block elem1, const cache_block elem2) {
-    int f = elem1.access_timestamp;
-    int s = elem2.access_timestamp;
-    if (f > s) return  1;
-    if (f < s) return -1;
-    return 0;
+  while (fgets(line, MAXLINELENGTH, symFile) != NULL) {
+    n = sscanf(line, "%d %d %s", &addr, &src, label);
+    if (n < 2) {
+      printf("error: bad line in symbol file %s: %s", symName, line);
+      exit(1);
+    }
+    if (addr < 0 || addr >= prof->size)
+      continue;
+    prof->line[addr] = src;
+    if (n == 3)
+      prof->label[addr] = strdup(label);
+  }
+  fclose(symFile);
 }
 
+/*
+ * Name pc by the closest label at or before it, "loop" or "loop+3".
+ */
+char *
+profWhere(profileType *prof, int pc, char *buf)
+{
+  int l;
+
+  for (l = pc; l >= 0 && prof->label[l] == NULL; --l)
+    ;
+  if (l < 0)
+    sprintf(buf, "pc%d", pc);
+  else if (l == pc)
+    sprintf(buf, "%s", prof->label[l]);
+  else
+    sprintf(buf, "%s+%d", prof->label[l], pc - l);
+  return buf;
+}
 
 /*
- * Log the specifics of each cache action.
- *
- * address is the starting word address of the range of data being transferred.
- * size is the size of the range of data being transferred.
- * type specifies the source and destination of the data being transferred.
- *     cacheToProcessor: reading data from the cache to the processor
- *     processorToCache: writing data from the processor to the cache
- *     memoryToCache: reading data from the memory to the cache
- *     cacheToMemory: evicting cache data by writing it to the memory
- *     cacheToNowhere: evicting cache data by throwing it away
+ * Basic blocks start at 0, at every label, and after and at the target
+ * of every beq that was executed.
  */
 void
-printAction(int address, int size, enum actionType type)
+profBlocks(profileType *prof, stateType *statePtr)
 {
-    printf("@@@ transferring word [%d-%d] ", address, address + size - 1);
-    if (type == cacheToProcessor) {
-        printf("from the cache to the processor\n");
-    } else if (type == processorToCache) {
-        printf("from the processor to the cache\n");
-    } else if (type == memoryToCache) {
-        printf("from the memory to the cache\n");
-    } else if (type == cacheToMemory) {
-        printf("from the cache to the memory\n");
-    } else if (type == cacheToNowhere) {
-        printf("from the cache to nowhere\n");
-    }
-}
+  int pc;
+  int instr;
+  int target;
 
-int
-cache_op(int op, int addr, int val, stateType *state, int n_sets, int b_size, int bps) {
-  int block_offset = (addr & BIT_MASK( (int)log2(b_size) ) );
-  int set_index = ( (addr >> (int)log2(b_size)) & BIT_MASK( (int)log2(n_sets) ) );
-  int tag = (addr >> (int)( log2(b_size) + log2(n_sets) ) );
+  prof->leader[0] = true;
+  for (pc = 0; pc < prof->size; ++pc) {
+    if (prof->label[pc] != NULL)
+      prof->leader[pc] = true;
 
-/*  printf("the address is %d\n the block_offset is %d\n the set_index is %d\n the tag is %d\n\n",
-          addr, block_offset, set_index, tag);*/
+    instr = memRead(statePtr, vmPhys(statePtr, pc));
+    if (prof->pc[pc].execs == 0 || ((instr >> 22) & 7) != beq)
+      continue;
 
-  int data;
-  data = 0;
-  int i;
-  int j;
-  int cur_blk;
-  int valid_found = false;
-
-  int mem_block_head = get_block_head(addr, b_size);
-
-
-  if ( (data = tag_exists(tag, state, set_index, block_offset, bps)) != -1 ) {
-    //printf("tag exists\n");
-    printAction(addr, 1, 0);
-    return data;
-  }
-
-  else if ( (data = tag_exists(tag, state, set_index, block_offset, bps)) == -1 ) {
-    // cache store
-    while( !valid_found) {
-      for (i = 0; i < bps; ++i) {
-        if ( !state->CACHE[set_index].blocks[i].valid ) {
-          valid_found = true;
-          cur_blk = 0;
-          state->CACHE[set_index].blocks[i].tag = tag;
-
-          printAction(mem_block_head, b_size, 2);
-          for (j = mem_block_head; j < (mem_block_head + b_size); ++j) {
-            state->CACHE[set_index].blocks[i].lines[cur_blk] = state->mem[j];
-            cur_blk++;
-          }
-
-          // Mark block valid
-          state->CACHE[set_index].blocks[i].valid = true;
-          state->CACHE[set_index].blocks[i].mem_head = mem_block_head;
-          state->CACHE[set_index].blocks[i].access_timestamp = TIMESTAMP;
-
-          if (op == 0) {
-            printAction(addr, 1, 0);
-            return state->CACHE[set_index].blocks[i].lines[block_offset];
-          }
-          else if (op == 1) {
-            printAction(addr, 1, 1);
-            state->CACHE[set_index].blocks[i].lines[block_offset] = val;
-            state->CACHE[set_index].blocks[i].dirty = true;
-            break;
-          }
-        }
-      }
-      if (valid_found == false) {
-        kick_lru(b_size, set_index, bps, state);
-      }
-    }
+    target = pc + 1 + convertNum(instr & 65535);
+    if (pc + 1 < prof->size)
+      prof->leader[pc + 1] = true;
+    if (target >= 0 && target < prof->size)
+      prof->leader[target] = true;
   }
+}
 
-  TIMESTAMP++;
+/* a basic block or a single word in the profile report */
+typedef struct profRowStruct {
+  int first;
+  int last;
+  long long instrs;
+  profEntry e; /* e.execs counts runs of the first word */
+} profRow;
+
+long long
+profCost(profRow *r)
+{
+  return r->e.imisses + r->e.dmisses + r->e.stalls;
 }
 
 int
-kick_lru(int b_size, int s_index, int bps, stateType *state) {
-  qsort (state->CACHE[s_index].blocks, bps, sizeof(cache_block), comp);
-  state->CACHE[s_index].blocks[0].lru = true;
-
-  int i;
-  int j;
-  int m_head;
-  int cur_blk;
+byInstrs(const void *a, const void *b)
+{
+  const profRow *x = a;
+  const profRow *y = b;
 
-  for (i = 0; i < bps; ++i) {
-    if (state->CACHE[s_index].blocks[i].lru) {
-      m_head = state->CACHE[s_index].blocks[i].mem_head;
-      state->CACHE[s_index].blocks[i].valid = false;
-      state->CACHE[s_index].blocks[i].lru = false;
-      state->CACHE[s_index].blocks[i].access_timestamp = 999;
-      state->CACHE[s_index].blocks[i].tag = 999;
+  if (x->instrs != y->instrs)
+    return x->instrs < y->instrs ? 1 : -1;
+  return x->first - y->first;
+}
 
-      if (state->CACHE[s_index].blocks[i].dirty == true) {
-        cur_blk = 0;
+int
+byCost(const void *a, const void *b)
+{
+  profRow *x = (profRow *)a;
+  profRow *y = (profRow *)b;
 
-        // re-init cache block
-        state->CACHE[s_index].blocks[i].dirty = false;
+  if (profCost(x) != profCost(y))
+    return profCost(x) < profCost(y) ? 1 : -1;
+  return byInstrs(a, b);
+}
 
-        //printf("the cache block [%d-%d] was dirty\n", m_head, m_head + (b_size -1));
+void
+printProfileRow(FILE *out, profileType *prof, profRow *r, long long total)
+{
+  char where[MAXLINELENGTH];
+  char range[64];
 
-        printAction(m_head, b_size, 3);
+  if (!prof->line[r->first] || !prof->line[r->last])
+    sprintf(range, "-");
+  else if (r->first == r->last)
+    sprintf(range, "%d", prof->line[r->first]);
+  else
+    sprintf(range, "%d-%d", prof->line[r->first], prof->line[r->last]);
 
-        for (j = m_head; j < (m_head + b_size); ++j) {
-          state->mem[j] = state->CACHE[s_index].blocks[i].lines[cur_blk];
-        }
-        return 0;
-      }
-      else {
-        printAction(m_head, b_size, 4);
-        return 0;
-      }
-    }
-  }
-  
+  fprintf(out, "  %-16s %5d %-9s %10lld %10lld %6.2f%% %8lld %8lld %8lld %8lld\n",
+          profWhere(prof, r->first, where), r->first, range, r->e.execs,
+          r->instrs, total ? 100.0 * r->instrs / total : 0.0, r->e.imisses,
+          r->e.dmisses, r->e.mispredicts, r->e.stalls);
 }
 
-int
-tag_exists(int tag, stateType *state, int set_i, int b_off, int bps) {
+/*
+ * The hot spot report: basic blocks by instructions executed, the words
+ * that cost the most cache misses and stall cycles, then every word that
+ * was run in pc order, which is what the analyzer's -check reads.
+ * profBlocks has to have been run first, as for printFolded.
+ */
+void
+printProfile(profileType *prof, FILE *out)
+{
+  profRow *blocks;
+  profRow *words;
+  profRow *r;
+  profRow row;
+  long long total = 0;
+  int nblocks = 0;
+  int nwords = 0;
+  int pc;
+  int i;
 
-  //printf("tag check:: tag: %d, set_i: %d, b_off: %d\n", tag, set_i, b_off);
+  blocks = calloc(prof->size, sizeof(profRow));
+  words = calloc(prof->size, sizeof(profRow));
 
-  int i;
-  for (i = 0; i < bps; ++i) {
-    if ( state->CACHE[set_i].blocks[i].tag == tag ) {
-      return state->CACHE[set_i].blocks[i].lines[b_off];
+  r = blocks;
+  for (pc = 0; pc < prof->size; ++pc) {
+    profEntry *e = &prof->pc[pc];
+
+    if (prof->leader[pc] || nblocks == 0) {
+      r = &blocks[nblocks++];
+      r->first = pc;
+      r->e.execs = e->execs;
+    }
+    r->last = pc;
+    r->instrs += e->execs;
+    r->e.imisses += e->imisses;
+    r->e.dmisses += e->dmisses;
+    r->e.mispredicts += e->mispredicts;
+    r->e.stalls += e->stalls;
+    total += e->execs;
+
+    if (e->execs) {
+      words[nwords].first = words[nwords].last = pc;
+      words[nwords].instrs = e->execs;
+      words[nwords++].e = *e;
     }
   }
 
-  return -1;
-}
+  qsort(blocks, nblocks, sizeof(profRow), byInstrs);
+  qsort(words, nwords, sizeof(profRow), byCost);
 
-int
-get_block_head(int addr, int b_size) {
-  return ( (addr / b_size) * b_size );
+  fprintf(out, "profile of %s: %lld instructions\n\n", prof->name, total);
+  fprintf(out, "basic blocks by instructions executed\n");
+  fprintf(out, "  %-16s %5s %-9s %10s %10s %7s %8s %8s %8s %8s\n", "block",
+          "pc", "lines", "entries", "instrs", "%", "imisses", "dmisses",
+          "mispred", "stalls");
+  for (i = 0; i < nblocks && blocks[i].instrs; ++i)
+    printProfileRow(out, prof, &blocks[i], total);
+
+  fprintf(out, "\ninstructions by cache misses and stall cycles\n");
+  fprintf(out, "  %-16s %5s %-9s %10s %10s %7s %8s %8s %8s %8s\n", "where",
+          "pc", "line", "execs", "instrs", "%", "imisses", "dmisses",
+          "mispred", "stalls");
+  for (i = 0; i < nwords && i < 20; ++i)
+    printProfileRow(out, prof, &words[i], total);
+
+  fprintf(out, "\nevery instruction executed, by pc\n");
+  fprintf(out, "  %-16s %5s %-9s %10s %10s %7s %8s %8s %8s %8s\n", "where",
+          "pc", "line", "execs", "instrs", "%", "imisses", "dmisses",
+          "mispred", "stalls");
+  for (pc = 0; pc < prof->size; ++pc) {
+    if (prof->pc[pc].execs == 0)
+      continue;
+    row.first = row.last = pc;
+    row.instrs = prof->pc[pc].execs;
+    row.e = prof->pc[pc];
+    printProfileRow(out, prof, &row, total);
+  }
+
+  free(blocks);
+  free(words);
 }
 
+/*
+ * Folded stacks for flame graph tools, "program;block;word count" for
+ * every word that was run, counting metric.
+ */
 void
-printState(stateType *statePtr)
+printFolded(profileType *prof, FILE *out, int metric)
 {
-  int i;
-  printf("\n@@@\nstate:\n");
-  printf("\tpc %d\n", statePtr->pc);
-  printf("\tmemory:\n");
+  char block[MAXLINELENGTH];
+  char where[MAXLINELENGTH];
+  profEntry *e;
+  long long count;
+  int first = 0;
+  int pc;
 
-  for (i=0; i< NUMMEMORY; i++) {
-    printf("\t\tmem[ %d ] %d\n", i, statePtr->mem[i]);
-  }
-  printf("\tregisters:\n");
+  for (pc = 0; pc < prof->size; ++pc) {
+    if (prof->leader[pc])
+      first = pc;
 
-  for (i=0; i<NUMREGS; i++) {
-    printf("\t\treg[ %d ] %d\n", i, statePtr->reg[i]);
+    e = &prof->pc[pc];
+    if (metric == fold_misses)
+      count = e->imisses + e->dmisses;
+    else if (metric == fold_stalls)
+      count = e->stalls;
+    else
+      count = e->execs;
+
+    if (count)
+      fprintf(out, "%s;%s;%s %lld\n", prof->name, profWhere(prof, first, block),
+              profWhere(prof, pc, where), count);
   }
-  printf("end state\n");
 }
 
 void
-printCache(stateType *state, int num_sets, int b_size, int bps) {
-  printf("cache\n");
-  int i;
-  int j;
-  int k;
-  for (i = 0; i < num_sets; ++i) {
-    printf("\tcache set %d\n", i);
-    for (k = 0; k < bps; ++k) {
-      printf("\t\tdirty: %d  block #%d\n", state->CACHE[i].blocks[k].dirty, k);
-      for (j = 0; j < b_size; ++j) {
-        printf("\t\t\tblock");
-        printf("[%d] = %d\n", j, state->CACHE[i].blocks[k].lines[j]);
-      }
+writeProfile(profileType *prof, stateType *statePtr, char *prof_name,
+    char *fold_name, int fold_metric)
+{
+  FILE *out;
+
+  profBlocks(prof, statePtr);
+
+  if (prof_name != NULL) {
+    if ( (out = fopen(prof_name, "w")) == NULL ) {
+      printf("error: can't open profile %s", prof_name);
+      perror("fopen");
+      exit(1);
     }
+    printProfile(prof, out);
+    fclose(out);
+  }
+
+  if (fold_name != NULL) {
+    if ( (out = fopen(fold_name, "w")) == NULL ) {
+      printf("error: can't open folded stacks %s", fold_name);
+      perror("fopen");
+      exit(1);
+    }
+    printFolded(prof, out, fold_metric);
+    fclose(out);
   }
-  printf("\n\n");
 }
 
 int
@@ -260,6 +4616,65 @@ convertNum(int num)
   return(num);
 }
 
+void
+usage(char *prog)
+{
+  printf("error: usage: %s <machine-code file> blockSizeInWords numberOfSets blocksPerSet [options]\n", prog);
+  printf("\t-m memoryWords\tsize of simulated memory (default %d)\n", NUMMEMORY);
+  printf("\t-s statsFile\twrite performance counters as JSON on exit\n");
+  printf("\t-i interval\talso sample the counters every interval instructions\n");
+  printf("\t-q\t\tdon't log cache actions\n");
+  printf("\t-t traceFile\trecord the cache reference stream\n");
+  printf("\t-S sectorWords\tsector the cache blocks, filling and writing back\n\t\t\tsectorWords words at a time (default: whole block)\n");
+  printf("\t-c cores\trun the program on this many cores with coherent\n\t\t\tprivate caches, core k starts with k in reg 1\n");
+  printf("\t-cp mesi|moesi\tcoherence protocol (default mesi)\n");
+  printf("\t-cq instrs\tinstructions per core per quantum (default 1000)\n");
+  printf("\t-cj threads\thost threads running the cores (default: one\n\t\t\tper processor)\n");
+  printf("\t-P file\t\tanother machine-code file to run against the same\n\t\t\tcache, in its own address space\n");
+  printf("\t-Ps rr|random|miss\thow programs take turns: round robin, at random,\n\t\t\tor round robin also switching on a miss (default rr)\n");
+  printf("\t-Pq instrs\tinstructions per turn (default 100)\n");
+  printf("\t-Pw equal|ucp|w0,w1,...\tpartition the ways between the programs\n");
+  printf("\t-Pi accesses\tcache accesses between UCP repartitions\n\t\t\t(default 50000)\n");
+  printf("\t-prof file\twrite a per basic block and per pc hot spot report\n");
+  printf("\t-fold file\twrite the profile as folded stacks for flame graphs\n");
+  printf("\t-foldm instrs|misses|stalls\twhat the folded stacks count\n\t\t\t(default instrs)\n");
+  printf("\t-rd file\twrite reuse distance histograms, block heat and set\n\t\t\tpressure as JSON\n");
+  printf("\t-opt\t\talso count misses under Belady's optimal replacement\n");
+  printf("\t-sym symFile\tname pcs in the profile with the assembler's -g output\n");
+  printf("\t-r\t\tthe input file is a reference trace, not machine code\n");
+  printf("\t-p\t\ttime execution on a five-stage pipeline\n");
+  printf("\t-pf 0|1\t\tpipeline forwarding (default 1)\n");
+  printf("\t-pb id|ex|mem\tstage that resolves beq (default ex)\n");
+  printf("\t-pk cycles\textra flush penalty for a mispredicted beq (default 0)\n");
+  printf("\t-pm cycles\tcache miss penalty (default 10)\n");
+  printf("\t-d\t\ttime fills and writebacks on a DRAM model, which\n\t\t\talso sets the pipeline's miss penalty\n");
+  printf("\t-dc channels\tDRAM channels (default 1)\n");
+  printf("\t-db banks\tbanks per channel (default 8)\n");
+  printf("\t-dr words\twords per row (default 512)\n");
+  printf("\t-dp open|closed\tpage policy (default open)\n");
+  printf("\t-dt cas,rcd,rp,burst\ttimings in cycles, burst per word\n\t\t\t(default 14,14,14,1)\n");
+  printf("\t-df refi,rfc\trefresh interval and length, 0 interval for no\n\t\t\trefresh (default 7800,350)\n");
+  printf("\t-dq entries\twrite queue entries (default 32)\n");
+  printf("\t-v pageWords\ttranslate every access through TLBs and a page table\n");
+  printf("\t-vl levels\tpage table levels (default 2)\n");
+  printf("\t-vh\t\tmap with huge pages one level above the leaves\n");
+  printf("\t-vc pipt|vipt\thow the cache is indexed (default pipt)\n");
+  printf("\t-vf random|seq\thow pages are placed in frames (default random)\n");
+  printf("\t-vp lru|fifo|random\tTLB replacement (default lru)\n");
+  printf("\t-v1 entries,ways,cycles\tL1 TLB (default 16,4,1)\n");
+  printf("\t-v2 entries,ways,cycles\tL2 TLB (default 256,8,6)\n");
+  printf("\t-z factor\tcompress blocks with BDI or FVC, with factor times\n\t\t\tblocksPerSet tags per set\n");
+  printf("\t-e\t\testimate energy, energy-delay product and area\n");
+  printf("\t-ec GHz\t\tclock for leakage and delay (default 1)\n");
+  printf("\t-et read,leak,act,word,area\ttechnology: pJ per bit of a 64 row\n\t\t\tarray, pW leakage per bit, pJ per DRAM activation,\n\t\t\tpJ per DRAM word, um^2 per bit\n\t\t\t(default 0.002,20,1500,400,0.5)\n");
+  printf("\t-D file\t\tdump the machine state as JSON lines, in full once\n\t\t\tthen only what changed since the dump before\n");
+  printf("\t-Di instrs\tinstructions between dumps (default 1)\n");
+  printf("\t-live file\tpublish live counters for simtop in file, best put\n\t\t\tunder /dev/shm\n");
+  printf("\t-bp predictor\tbeq predictor: nt, btfn, bimodal, gshare, tournament\n\t\t\tor tage (default nt)\n");
+  printf("\t-bk cycles\tcycles lost per mispredicted beq when not pipelined\n\t\t\t(default 2)\n");
+  exit(1);
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -288,36 +4703,436 @@ main(int argc, char *argv[])
   int offset;
   int num_instr;
   int is_halt;
+  int word;
+  int i;
+
+  /*
+   * Options
+  */
+  int mem_size;
+  char *stats_name;
+  FILE *stats_file;
+  int sample_interval;
+  char *record_name;
+  int replay;
+  traceType trace_in;
+  int sector_size;
+  char *protocol;
+  char *partition;
+  char *sym_name;
+  char *prof_name;
+  char *fold_name;
+  char *rd_name;
+  char *live_name;
+  char *dump_name;
+  int belady;
+  int fold_metric;
+  int prof_pc;
+  long long stalls;
+  profEntry *prof_entry;
+
+  if (argc < 5)
+    usage(argv[0]);
+
+  mem_size = NUMMEMORY;
+  stats_name = NULL;
+  stats_file = NULL;
+  sample_interval = 0;
+  record_name = NULL;
+  replay = false;
+  sector_size = 0;
+  protocol = "mesi";
+  partition = NULL;
+  sym_name = NULL;
+  prof_name = NULL;
+  fold_name = NULL;
+  rd_name = NULL;
+  live_name = NULL;
+  LIVE.left = LLONG_MAX;
+  dump_name = NULL;
+  DUMP.interval = 1;
+  belady = false;
+  fold_metric = fold_instrs;
+  MP.count = 1;
+  MP.slice = 100;
+  MP.seed = 3101;
+  MP.interval = 50000;
+  MP.prog = calloc(argc, sizeof(progType));
+  MP.prog[0].name = argv[1];
+  MULTI.cores = 1;
+  MULTI.quantum = 1000;
+  PIPE.forwarding = true;
+  PIPE.resolve_stage = EX;
+  PIPE.miss_penalty = 10;
+  BP.penalty = 2;
+  DRAM.channels = 1;
+  DRAM.banks = 8;
+  DRAM.row_words = 512;
+  DRAM.tCAS = 14;
+  DRAM.tRCD = 14;
+  DRAM.tRP = 14;
+  DRAM.tBurst = 1;
+  DRAM.tREFI = 7800;
+  DRAM.tRFC = 350;
+  DRAM.depth = 32;
+  VM.levels = 2;
+  VM.random_frames = true;
+  VM.seed = 3101;
+  VM.l1.entries = 16;
+  VM.l1.ways = 4;
+  VM.l1.latency = 1;
+  VM.l2.entries = 256;
+  VM.l2.ways = 8;
+  VM.l2.latency = 6;
+  ENERGY.ghz = 1;
+  ENERGY.bit_read = 0.002;
+  ENERGY.bit_leak = 20;
+  ENERGY.dram_act = 1500;
+  ENERGY.dram_word = 400;
+  ENERGY.bit_area = 0.5;
+
+  for (i = 5; i < argc; ++i) {
+    if (!strcmp(argv[i], "-m") && i + 1 < argc)
+      mem_size = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+      stats_name = argv[++i];
+    else if (!strcmp(argv[i], "-i") && i + 1 < argc)
+      sample_interval = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-q"))
+      QUIET = true;
+    else if (!strcmp(argv[i], "-t") && i + 1 < argc)
+      record_name = argv[++i];
+    else if (!strcmp(argv[i], "-S") && i + 1 < argc)
+      sector_size = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-c") && i + 1 < argc)
+      MULTI.cores = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-cp") && i + 1 < argc)
+      protocol = argv[++i];
+    else if (!strcmp(argv[i], "-cq") && i + 1 < argc)
+      MULTI.quantum = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-cj") && i + 1 < argc)
+      MULTI.threads = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-P") && i + 1 < argc)
+      MP.prog[MP.count++].name = argv[++i];
+    else if (!strcmp(argv[i], "-Ps") && i + 1 < argc) {
+      ++i;
+      if (!strcmp(argv[i], "rr"))
+        MP.schedule = sched_rr;
+      else if (!strcmp(argv[i], "random"))
+        MP.schedule = sched_random;
+      else if (!strcmp(argv[i], "miss"))
+        MP.schedule = sched_miss;
+      else
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-Pq") && i + 1 < argc)
+      MP.slice = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-Pw") && i + 1 < argc)
+      partition = argv[++i];
+    else if (!strcmp(argv[i], "-Pi") && i + 1 < argc)
+      MP.interval = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-rd") && i + 1 < argc)
+      rd_name = argv[++i];
+    else if (!strcmp(argv[i], "-opt"))
+      belady = true;
+    else if (!strcmp(argv[i], "-sym") && i + 1 < argc)
+      sym_name = argv[++i];
+    else if (!strcmp(argv[i], "-prof") && i + 1 < argc)
+      prof_name = argv[++i];
+    else if (!strcmp(argv[i], "-fold") && i + 1 < argc)
+      fold_name = argv[++i];
+    else if (!strcmp(argv[i], "-foldm") && i + 1 < argc) {
+      ++i;
+      if (!strcmp(argv[i], "instrs"))
+        fold_metric = fold_instrs;
+      else if (!strcmp(argv[i], "misses"))
+        fold_metric = fold_misses;
+      else if (!strcmp(argv[i], "stalls"))
+        fold_metric = fold_stalls;
+      else
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-r"))
+      replay = true;
+    else if (!strcmp(argv[i], "-p"))
+      PIPE.enabled = true;
+    else if (!strcmp(argv[i], "-pf") && i + 1 < argc)
+      PIPE.forwarding = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-pb") && i + 1 < argc) {
+      ++i;
+      if (!strcmp(argv[i], "id"))
+        PIPE.resolve_stage = ID;
+      else if (!strcmp(argv[i], "ex"))
+        PIPE.resolve_stage = EX;
+      else if (!strcmp(argv[i], "mem"))
+        PIPE.resolve_stage = MEM;
+      else
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-pk") && i + 1 < argc)
+      PIPE.flush_penalty = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-pm") && i + 1 < argc)
+      PIPE.miss_penalty = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-d"))
+      DRAM.enabled = true;
+    else if (!strcmp(argv[i], "-dc") && i + 1 < argc)
+      DRAM.channels = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-db") && i + 1 < argc)
+      DRAM.banks = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-dr") && i + 1 < argc)
+      DRAM.row_words = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-dp") && i + 1 < argc) {
+      ++i;
+      if (!strcmp(argv[i], "open"))
+        DRAM.closed_page = false;
+      else if (!strcmp(argv[i], "closed"))
+        DRAM.closed_page = true;
+      else
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-dt") && i + 1 < argc) {
+      if (sscanf(argv[++i], "%d,%d,%d,%d", &DRAM.tCAS, &DRAM.tRCD, &DRAM.tRP,
+                 &DRAM.tBurst) != 4)
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-df") && i + 1 < argc) {
+      if (sscanf(argv[++i], "%d,%d", &DRAM.tREFI, &DRAM.tRFC) != 2)
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-dq") && i + 1 < argc)
+      DRAM.depth = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-v") && i + 1 < argc) {
+      VM.enabled = true;
+      VM.page_words = atoi(argv[++i]);
+    }
+    else if (!strcmp(argv[i], "-vl") && i + 1 < argc)
+      VM.levels = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-vh"))
+      VM.huge = true;
+    else if (!strcmp(argv[i], "-vc") && i + 1 < argc) {
+      ++i;
+      if (!strcmp(argv[i], "pipt"))
+        VM.vipt = false;
+      else if (!strcmp(argv[i], "vipt"))
+        VM.vipt = true;
+      else
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-vf") && i + 1 < argc) {
+      ++i;
+      if (!strcmp(argv[i], "seq"))
+        VM.random_frames = false;
+      else if (!strcmp(argv[i], "random"))
+        VM.random_frames = true;
+      else
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-vp") && i + 1 < argc) {
+      ++i;
+      if (!strcmp(argv[i], "lru"))
+        VM.policy = tlb_lru;
+      else if (!strcmp(argv[i], "fifo"))
+        VM.policy = tlb_fifo;
+      else if (!strcmp(argv[i], "random"))
+        VM.policy = tlb_random;
+      else
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-v1") && i + 1 < argc) {
+      if (sscanf(argv[++i], "%d,%d,%d", &VM.l1.entries, &VM.l1.ways,
+                 &VM.l1.latency) != 3)
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-v2") && i + 1 < argc) {
+      if (sscanf(argv[++i], "%d,%d,%d", &VM.l2.entries, &VM.l2.ways,
+                 &VM.l2.latency) != 3)
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-z") && i + 1 < argc)
+      ZIP.factor = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-live") && i + 1 < argc)
+      live_name = argv[++i];
+    else if (!strcmp(argv[i], "-D") && i + 1 < argc)
+      dump_name = argv[++i];
+    else if (!strcmp(argv[i], "-Di") && i + 1 < argc)
+      DUMP.interval = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-e"))
+      ENERGY.enabled = true;
+    else if (!strcmp(argv[i], "-ec") && i + 1 < argc)
+      ENERGY.ghz = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-et") && i + 1 < argc) {
+      if (sscanf(argv[++i], "%lf,%lf,%lf,%lf,%lf", &ENERGY.bit_read,
+                 &ENERGY.bit_leak, &ENERGY.dram_act, &ENERGY.dram_word,
+                 &ENERGY.bit_area) != 5)
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-bp") && i + 1 < argc) {
+      if ( (BP.kind = bpKind(argv[++i])) < 0 )
+        usage(argv[0]);
+    }
+    else if (!strcmp(argv[i], "-bk") && i + 1 < argc)
+      BP.penalty = atoi(argv[++i]);
+    else
+      usage(argv[0]);
+  }
 
-  if (argc != 5) {
-    printf("error: usage: %s <machine-code file> blockSizeInWords numberOfSets blocksPerSet\n", argv[0]);
+  if (mem_size <= 0 || sample_interval < 0 || sector_size < 0 || PIPE.flush_penalty < 0 ||
+      PIPE.miss_penalty < 0 || BP.penalty < 0)
+    usage(argv[0]);
+  bpInit(&BP);
+
+  if (MULTI.cores <= 0 || MULTI.quantum <= 0 || MULTI.threads < 0 ||
+      MP.slice <= 0 || MP.interval <= 0)
+    usage(argv[0]);
+  if (MP.count == 1 && partition != NULL) {
+    printf("error: -Pw needs more than one program\n");
+    exit(1);
+  }
+  if (MP.count > 1 && (PIPE.enabled || replay || MULTI.cores > 1 ||
+                       sample_interval)) {
+    printf("error: -P can't be combined with -p, -r, -c or -i\n");
+    exit(1);
+  }
+  if ((prof_name != NULL || fold_name != NULL) &&
+      (replay || MULTI.cores > 1 || MP.count > 1)) {
+    printf("error: -prof and -fold can't be combined with -r, -c or -P\n");
+    exit(1);
+  }
+  if (DRAM.channels <= 0 || DRAM.banks <= 0 || DRAM.row_words <= 0 ||
+      DRAM.tCAS < 0 || DRAM.tRCD < 0 || DRAM.tRP < 0 || DRAM.tBurst < 0 ||
+      DRAM.tREFI < 0 || DRAM.tRFC < 0 || DRAM.depth <= 0 ||
+      DRAM.depth > DRAMQUEUE)
+    usage(argv[0]);
+  if (VM.enabled) {
+    if (VM.page_words < 2 || (VM.page_words & (VM.page_words - 1)) ||
+        VM.levels < 1 + VM.huge || VM.levels > 8)
+      usage(argv[0]);
+    if (VM.l1.ways <= 0 || VM.l1.entries % VM.l1.ways || VM.l1.entries > TLBMAX ||
+        VM.l2.ways <= 0 || VM.l2.entries % VM.l2.ways || VM.l2.entries > TLBMAX ||
+        VM.l1.entries <= 0 || VM.l2.entries <= 0 ||
+        VM.l1.latency < 0 || VM.l2.latency < 0) {
+      printf("error: TLB entries must be a positive multiple of the ways, at most %d\n",
+             TLBMAX);
+      exit(1);
+    }
+    if (MULTI.cores > 1) {
+      printf("error: -v can't be combined with -c\n");
+      exit(1);
+    }
+  }
+  if (DRAM.enabled && MULTI.cores > 1) {
+    printf("error: -d can't be combined with -c\n");
+    exit(1);
+  }
+  if (ENERGY.ghz <= 0 || ENERGY.bit_read < 0 || ENERGY.bit_leak < 0 ||
+      ENERGY.dram_act < 0 || ENERGY.dram_word < 0 || ENERGY.bit_area < 0)
+    usage(argv[0]);
+  if (ENERGY.enabled && MULTI.cores > 1) {
+    printf("error: -e can't be combined with -c\n");
+    exit(1);
+  }
+  if (ZIP.factor < 0)
+    usage(argv[0]);
+  if (ZIP.factor && (MULTI.cores > 1 || sector_size || partition != NULL ||
+                     belady)) {
+    printf("error: -z can't be combined with -c, -S, -Pw or -opt\n");
     exit(1);
   }
+  if (live_name != NULL && MULTI.cores > 1) {
+    printf("error: -live can't be combined with -c\n");
+    exit(1);
+  }
+  if (DUMP.interval <= 0)
+    usage(argv[0]);
+  if (dump_name != NULL && (replay || MULTI.cores > 1 || MP.count > 1)) {
+    printf("error: -D can't be combined with -r, -c or -P\n");
+    exit(1);
+  }
+  if ((rd_name != NULL || belady) && MULTI.cores > 1) {
+    printf("error: -rd and -opt can't be combined with -c\n");
+    exit(1);
+  }
+  if (!strcmp(protocol, "moesi"))
+    MULTI.moesi = true;
+  else if (strcmp(protocol, "mesi"))
+    usage(argv[0]);
+  if (MULTI.cores > 1) {
+    if (PIPE.enabled || replay || record_name != NULL || sample_interval ||
+        sector_size) {
+      printf("error: -c can't be combined with -p, -r, -t, -i or -S\n");
+      exit(1);
+    }
+    // cache actions from several threads would interleave
+    QUIET = true;
+    if (MULTI.threads == 0)
+      MULTI.threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (MULTI.threads > MULTI.cores || MULTI.threads <= 0)
+      MULTI.threads = MULTI.cores;
+  }
 
-  filePtr = fopen(argv[1], "r");
-    if (filePtr == NULL) {
-      printf("error: can't open file %s", argv[1]);
+  if (PIPE.enabled && replay) {
+    printf("error: the pipeline model needs a program, not a trace\n");
+    exit(1);
+  }
+  pipeInit(&PIPE);
+
+  if (stats_name != NULL) {
+    stats_file = fopen(stats_name, "w");
+    if (stats_file == NULL) {
+      printf("error: can't open stats file %s", stats_name);
       perror("fopen");
       exit(1);
-      }
+    }
+    fprintf(stats_file, "{\n  \"samples\": [\n");
+    STATS_OUT = stats_file;
+    atexit(statsAbort);
+  }
 
   /*
-   * Initialise the state of the machine. Initialise all of
-   * the mem to 0;
+   * Initialise the state of the machine. Memory starts out with no
+   * pages, which reads as all 0;
    */
-  int i;
-  for (i = 0; i < NUMMEMORY; ++i) {
-    state.mem[i] = 0;
+  MP.mem = mem_size;
+  if (VM.enabled)
+    vmInit(&VM, &state, mem_size * MP.count);
+  else
+    initMemory(&state, mem_size * MP.count);
+  state.numMemory = 0;
+
+  /* a trace isn't read as machine code, filePtr stays NULL */
+  filePtr = NULL;
+  if (replay)
+    traceOpen(&trace_in, argv[1]);
+  else {
+    filePtr = fopen(argv[1], "r");
+    if (filePtr == NULL) {
+      printf("error: can't open file %s", argv[1]);
+      perror("fopen");
+      exit(1);
+    }
   }
 
+  if (record_name != NULL)
+    traceCreate(&TRACE_OUT, record_name);
+
+  if (live_name != NULL)
+    liveOpen(&LIVE, live_name, argv[1]);
+
   /* read in the entire machine-code file into memory */
-  for (state.numMemory = 0; fgets(line, MAXLINELENGTH, filePtr) != NULL;
+  for ( ; filePtr != NULL && fgets(line, MAXLINELENGTH, filePtr) != NULL;
     state.numMemory++) {
-    if (sscanf(line, "%d", state.mem+state.numMemory) != 1) {
+    if (sscanf(line, "%d", &word) != 1) {
         printf("error in reading address %d\n", state.numMemory);
         exit(1);
     }
-    //printf("memory[%d]=%d\n", state.numMemory, state.mem[state.numMemory]);
+    memWrite(&state, vmPhys(&state, state.numMemory), word);
+    //printf("memory[%d]=%d\n", state.numMemory, word);
+  }
+
+  if (prof_name != NULL || fold_name != NULL) {
+    profInit(&PROF, state.numMemory, argv[1]);
+    if (sym_name != NULL)
+      profSymbols(&PROF, sym_name);
   }
 
   /*
@@ -337,35 +5152,75 @@ main(int argc, char *argv[])
   blocks_per_set = atoi(argv[4]);
   cache_size = ( block_size * number_sets * blocks_per_set );
 
-  state.CACHE = malloc( number_sets * sizeof(cache_set *) );
-
-  for (i = 0; i < number_sets; ++i) {
-    cache_set new_cache_set;
-
-    new_cache_set.blocks = malloc ( blocks_per_set * sizeof(cache_block) );
-
-    int j;
-    int k;
-    for (j = 0; j < blocks_per_set; ++j) {
-      new_cache_set.blocks[j].lines = malloc ( block_size * sizeof(int) );
-      new_cache_set.blocks[j].tag = 999;
-      new_cache_set.blocks[j].valid = false;
-      new_cache_set.blocks[j].dirty = false;
-      new_cache_set.blocks[j].lru = false;
-      new_cache_set.blocks[j].access_timestamp = 9999;
+  if (sector_size == 0)
+    sector_size = block_size;
+  if (block_size <= 0 || number_sets <= 0 || blocks_per_set <= 0)
+    usage(argv[0]);
+  if (block_size % sector_size != 0 || block_size / sector_size > MAXSECTORS) {
+    printf("error: block size must be a multiple of the sector size, with at most %d sectors\n",
+           MAXSECTORS);
+    exit(1);
+  }
 
-      for (k = 0; k < block_size; ++k)
-        new_cache_set.blocks[j].lines[k] = 0;
-    }
+  if (DRAM.enabled && DRAM.row_words % block_size != 0) {
+    printf("error: the dram row size must be a multiple of the block size\n");
+    exit(1);
+  }
 
-    state.CACHE[i] = new_cache_set;
+  if (VM.enabled && VM.vipt &&
+      (1 << VM.unit_bits) % (block_size * number_sets) != 0) {
+    printf("error: a VIPT cache needs sets * block size to divide the %d word page\n",
+           1 << VM.unit_bits);
+    exit(1);
   }
 
+  initCache(&state, block_size, number_sets, blocks_per_set * (ZIP.factor ? ZIP.factor : 1),
+            sector_size);
+  if (ZIP.factor)
+    initZip(&ZIP, &state);
+  if (DRAM.enabled)
+    dramInit(&DRAM);
+  STATS.set_conflicts = calloc(number_sets, sizeof(long long));
+  mpPartition(&state, partition);
+  if (rd_name != NULL)
+    rdInit(&RD, &state, replay || MP.count > 1 ? 0 : state.numMemory);
+  if (belady)
+    minInit(&MIN);
+  if (dump_name != NULL)
+    dumpOpen(&DUMP, &state, dump_name);
+
 
   num_instr = 0;
   state.pc = 0;
   is_halt = false;
   int mem_data;
+  long long imisses;
+  long long dmisses;
+  long long istall;
+  long long dstall;
+  long long itrans;
+  long long dtrans;
+  int mispredict;
+
+  /* a replayed trace has no program to run */
+  if (replay) {
+    replayTrace(&trace_in, &state);
+    traceClose(&trace_in);
+    is_halt = true;
+  }
+
+  if (MULTI.cores > 1) {
+    runMulticore(&state, sector_size);
+    is_halt = true;
+  }
+
+  if (MP.count > 1) {
+    runPrograms(&state);
+    is_halt = true;
+  }
+
+  if (DUMP.file != NULL)
+    dumpState(&DUMP, &state, 0);
 
   while ( !is_halt ) {
     mem_data = 999;
@@ -374,8 +5229,20 @@ main(int argc, char *argv[])
 
     
 
-    int instr = cache_op( 0, state.pc, 0, &state, number_sets, block_size, blocks_per_set );
-    //int instr = state.mem[state.pc];
+    imisses = STATS.misses[fetch];
+    dmisses = STATS.misses[load] + STATS.misses[store] - VM.walk_misses;
+    istall = DRAM.stall - VM.walk_dram;
+    itrans = VM.stall;
+    mispredict = false;
+    prof_pc = state.pc;
+    RD.pc = state.pc;
+    for (stalls = 0, i = 0; PROF.pc != NULL && i < NUMSTALLS; ++i)
+      stalls += PIPE.stalls[i];
+
+    int instr = cache_op( fetch, state.pc, 0, &state );
+    //int instr = memRead(&state, state.pc);
+    dstall = DRAM.stall - VM.walk_dram;
+    dtrans = VM.stall;
 
     opcode = ( (instr >> 22) & 7 );
 
@@ -388,6 +5255,8 @@ main(int argc, char *argv[])
 
     //printf("pc is %d instr is %d, opcode is %d\n",state.pc, instr, opcode);
 
+    STATS.opcodes[opcode]++;
+
     switch (opcode) {
       case add:
         if ( destR != 0)
@@ -408,10 +5277,11 @@ main(int argc, char *argv[])
         break;
 
       case lw:
-        if ( destR != 0) {
-          //state.reg[regB] = state.mem[ (state.reg[regA] + offset) ];
-          mem_data = cache_op( 0, (state.reg[regA] + offset), 0, &state, number_sets, block_size, blocks_per_set );
+        if ( regB != 0) {
+          //state.reg[regB] = memRead(&state, state.reg[regA] + offset);
+          mem_data = cache_op( load, (state.reg[regA] + offset), 0, &state );
           state.reg[regB] = mem_data;
+          STATS.loads++;
         }
         else
           exit(1);
@@ -420,16 +5290,23 @@ main(int argc, char *argv[])
         break;
 
       case sw:
-        //state.mem[ (state.reg[regA] + offset) ] = state.reg[regB];
-        cache_op( 1, (state.reg[regA] + offset), state.reg[regB], &state, number_sets, block_size, blocks_per_set );
+        //memWrite(&state, state.reg[regA] + offset, state.reg[regB]);
+        cache_op( store, (state.reg[regA] + offset), state.reg[regB], &state );
+        STATS.stores++;
         state.pc++;
         break;
 
       case beq:
-        if ( state.reg[regA] == state.reg[regB] )
+        mispredict = bpBranch(&BP, state.pc, state.reg[regA] == state.reg[regB],
+                              state.pc + 1 + offset);
+        if ( state.reg[regA] == state.reg[regB] ) {
           state.pc = (state.pc + 1 + offset);
-        else
+          STATS.beq_taken++;
+        }
+        else {
           state.pc++;
+          STATS.beq_not_taken++;
+        }
         break;
 
       case cmov:
@@ -454,6 +5331,96 @@ main(int argc, char *argv[])
     }
 
     num_instr++;
+    STATS.instrs++;
+
+    if (PIPE.enabled)
+      pipeStep(&PIPE, opcode, regA, regB, destR, mispredict,
+               missPenalty(STATS.misses[fetch] != imisses, dstall - istall) +
+               dtrans - itrans,
+               missPenalty(STATS.misses[load] + STATS.misses[store] -
+                           VM.walk_misses != dmisses,
+                           DRAM.stall - VM.walk_dram - dstall) +
+               VM.stall - dtrans);
+
+    if (PROF.pc != NULL && prof_pc >= 0 && prof_pc < PROF.size) {
+      prof_entry = &PROF.pc[prof_pc];
+      prof_entry->execs++;
+      prof_entry->imisses += STATS.misses[fetch] - imisses;
+      prof_entry->dmisses += STATS.misses[load] + STATS.misses[store] - dmisses;
+      prof_entry->mispredicts += mispredict;
+      if (PIPE.enabled) {
+        for (stalls = -stalls, i = 0; i < NUMSTALLS; ++i)
+          stalls += PIPE.stalls[i];
+        prof_entry->stalls += stalls;
+      }
+      else
+        prof_entry->stalls += mispredict * BP.penalty;
+    }
+
+    if (stats_file != NULL && sample_interval && num_instr % sample_interval == 0)
+      printStatsSample(stats_file, num_instr == sample_interval);
+
+    if (DUMP.file != NULL && (num_instr % DUMP.interval == 0 || is_halt))
+      dumpState(&DUMP, &state, num_instr);
+  }
+
+  traceClose(&TRACE_OUT);
+
+  if (PIPE.enabled)
+    printf("pipeline: %lld cycles, %lld instructions, CPI %.3f\n",
+           PIPE.cycles, PIPE.instrs,
+           PIPE.instrs ? (double)PIPE.cycles / PIPE.instrs : 0.0);
+
+  if (PROF.pc != NULL)
+    writeProfile(&PROF, &state, prof_name, fold_name, fold_metric);
+
+  if (rd_name != NULL)
+    printReuse(&RD, &state, rd_name);
+
+  if (DRAM.enabled) {
+    dramDrain(&DRAM, 0);
+    printf("dram: %lld reads, %lld writes, %.1f%% row hits, %.1f cycles per fill\n",
+           DRAM.reads, DRAM.writes,
+           DRAM.row_hits + DRAM.row_empty + DRAM.row_conflicts ?
+           100.0 * DRAM.row_hits / (DRAM.row_hits + DRAM.row_empty + DRAM.row_conflicts) : 0.0,
+           DRAM.reads ? (double)DRAM.stall / DRAM.reads : 0.0);
+  }
+
+  if (VM.enabled)
+    printf("vm: %lld l1 tlb misses, %lld l2 tlb misses, %lld walk cycles, %lld translation cycles\n",
+           VM.l1.misses, VM.l2.misses, VM.walk_cycles, VM.stall);
+
+  if (belady) {
+    minRun(&MIN, &state);
+    printf("belady: %lld misses, lru %lld\n",
+           MIN.misses[fetch] + MIN.misses[load] + MIN.misses[store],
+           STATS.misses[fetch] + STATS.misses[load] + STATS.misses[store] -
+           STATS.sector_misses);
+  }
+
+  if (ZIP.factor) {
+    ZIP.occupancy = zipOccupancy(&state);
+    printf("compression: ratio %.2f, %.2f blocks per way, %lld misses against %lld uncompressed\n",
+           ZIP.packed_words ? (double)ZIP.raw_words / ZIP.packed_words : 0.0,
+           ZIP.occupancy,
+           STATS.misses[fetch] + STATS.misses[load] + STATS.misses[store],
+           ZIP.shadow_misses);
+  }
+
+  if (ENERGY.enabled) {
+    energyRun(&ENERGY, &state, mem_size * MP.count);
+    printf("energy: %.1f nJ, %lld cycles, EDP %.3e J*s, area %.4f mm^2, %.1f MIPS/W\n",
+           energyTotal(&ENERGY) / 1e3, ENERGY.cycles,
+           energyTotal(&ENERGY) * 1e-12 * ENERGY.cycles / (ENERGY.ghz * 1e9),
+           ENERGY.area,
+           energyTotal(&ENERGY) > 0 ?
+           STATS.instrs / (energyTotal(&ENERGY) * 1e-12) / 1e6 : 0.0);
+  }
+
+  if (stats_file != NULL) {
+    STATS_OUT = NULL;
+    printStatsFinal(stats_file, number_sets);
+    fclose(stats_file);
   }
 
 /*  printf("machine halted\n");
@@ -461,5 +5428,14 @@ main(int argc, char *argv[])
   printf("final state of machine:\n");
   printState(&state);*/
 
+  if (LIVE.shm != NULL)
+    livePublish(&LIVE, &state, true);
+
+  if (DUMP.file != NULL)
+    fclose(DUMP.file);
+
+  bpFree(&BP);
+  freeState(&state);
+
   return(0);
 }
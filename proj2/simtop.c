@@ -0,0 +1,207 @@
+/*
+ * simtop: watch running simulators. Each file named is the -live file of
+ * a proj1 or proj2 simulator; simtop maps it read only and redraws one
+ * line per simulator every interval, so a long sweep can be watched and
+ * a bad run killed by its pid without waiting for it to exit. Reads go
+ * through the sequence lock and never hold the simulator up. A file that
+ * doesn't exist yet is waited for, and one that is recreated by a new run
+ * is mapped again.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define LIVEMAGIC 0x4c495645
+
+enum { false, true };
+
+/* must match liveShared in proj1/simulator.c and proj2/sim.c */
+typedef struct liveSharedStruct {
+  unsigned magic;
+  unsigned seq;
+  int pid;
+  int done; /* the simulator finished */
+  int pc;
+  int cache; /* the counters below mean something */
+  long long instrs;
+  long long accesses;
+  long long hits;
+  long long misses;
+  long long start_ns;
+  long long now_ns;
+  char sim[16];
+  char name[64];
+} liveShared;
+
+typedef struct watchStruct {
+  char *path;
+  liveShared *shm; /* NULL until the file shows up */
+  ino_t ino;
+  liveShared last; /* previous consistent read */
+  int have_last;
+} watchType;
+
+void usage(char *);
+
+/*
+ * Take a consistent copy of shm, false if the simulator was caught
+ * writing every time, which it only is for a moment unless it died
+ * half way through an update.
+ */
+int
+liveRead(liveShared *shm, liveShared *out)
+{
+  unsigned seq;
+  int tries;
+
+  for (tries = 0; tries < 1000; ++tries) {
+    seq = __atomic_load_n(&shm->seq, __ATOMIC_ACQUIRE);
+    if (seq & 1)
+      continue;
+    memcpy(out, shm, sizeof(liveShared));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&shm->seq, __ATOMIC_RELAXED) == seq)
+      return true;
+  }
+  return false;
+}
+
+/*
+ * Map w's file if it's there and isn't the one already mapped.
+ */
+void
+watchMap(watchType *w)
+{
+  struct stat st;
+  void *p;
+  int fd;
+
+  if (stat(w->path, &st) < 0 || st.st_size < (off_t)sizeof(liveShared))
+    return;
+  if (w->shm != NULL && st.st_ino == w->ino)
+    return;
+
+  fd = open(w->path, O_RDONLY);
+  if (fd < 0)
+    return;
+  p = mmap(NULL, sizeof(liveShared), PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED)
+    return;
+
+  if (w->shm != NULL)
+    munmap(w->shm, sizeof(liveShared));
+  w->shm = p;
+  w->ino = st.st_ino;
+  w->have_last = false;
+}
+
+void
+printWatch(watchType *w)
+{
+  liveShared now;
+  char *state;
+  double mips;
+  double avg;
+  double secs;
+
+  watchMap(w);
+  if (w->shm == NULL || __atomic_load_n(&w->shm->magic, __ATOMIC_ACQUIRE) != LIVEMAGIC) {
+    printf("%-20.20s %-5s %7s %-8s\n", w->path, "-", "-", "waiting");
+    return;
+  }
+  if (!liveRead(w->shm, &now)) {
+    printf("%-20.20s %-5s %7s %-8s\n", w->path, "-", "-", "torn");
+    return;
+  }
+
+  if (now.done)
+    state = "done";
+  else if (kill(now.pid, 0) < 0 && errno == ESRCH)
+    state = "died";
+  else
+    state = "running";
+
+  secs = (now.now_ns - now.start_ns) / 1e9;
+  avg = secs > 0 ? now.instrs / secs / 1e6 : 0.0;
+  mips = avg;
+  if (w->have_last && now.now_ns > w->last.now_ns)
+    mips = (now.instrs - w->last.instrs) * 1e3 / (now.now_ns - w->last.now_ns);
+  else if (w->have_last)
+    mips = 0.0;
+  if (now.done)
+    mips = avg;
+
+  printf("%-20.20s %-5s %7d %-8s %14lld %9.2f %9.2f", now.name, now.sim,
+         now.pid, state, now.instrs, mips, avg);
+  if (now.cache)
+    printf(" %14lld %7.2f%%", now.accesses,
+           now.accesses ? 100.0 * now.hits / now.accesses : 0.0);
+  else
+    printf(" %14s %8s", "-", "-");
+  printf(" %7d %9.1f\n", now.pc, secs);
+
+  w->last = now;
+  w->have_last = true;
+}
+
+void
+usage(char *prog)
+{
+  printf("error: usage: %s [options] liveFile...\n", prog);
+  printf("\t-n ms\t\tredraw interval (default 1000)\n");
+  printf("\t-1\t\tprint once and exit, without clearing the screen\n");
+  exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct timespec delay;
+  watchType *watch;
+  int n_watch = 0;
+  int interval = 1000;
+  int once = false;
+  int i;
+
+  watch = calloc(argc, sizeof(watchType));
+  for (i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc)
+      interval = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-1"))
+      once = true;
+    else if (argv[i][0] == '-')
+      usage(argv[0]);
+    else
+      watch[n_watch++].path = argv[i];
+  }
+  if (n_watch == 0 || interval <= 0)
+    usage(argv[0]);
+
+  delay.tv_sec = interval / 1000;
+  delay.tv_nsec = (interval % 1000) * 1000000L;
+
+  for (;;) {
+    if (!once)
+      printf("\033[H\033[J");
+    printf("%-20s %-5s %7s %-8s %14s %9s %9s %14s %8s %7s %9s\n", "program",
+           "sim", "pid", "state", "instrs", "MIPS", "avg MIPS", "accesses",
+           "hits", "pc", "seconds");
+    for (i = 0; i < n_watch; ++i)
+      printWatch(&watch[i]);
+    fflush(stdout);
+    if (once)
+      break;
+    nanosleep(&delay, NULL);
+  }
+
+  return(0);
+}